@@ -13,18 +13,35 @@
  */
 
 #include <cstdint>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 namespace partition {
 
 /**
  * @brief Represents a single element in a Partition problem instance.
+ *
+ * Allocator-aware: when stored in a std::pmr container the id is allocated
+ * from the container's memory resource.
  */
 class PartitionElement {
  public:
-  PartitionElement(const std::string& id, uint64_t size);
-
-  auto id() const -> const std::string& { return id_; }
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+  PartitionElement(std::string_view id, uint64_t size,
+                   const allocator_type& alloc = {});
+  PartitionElement(const PartitionElement& other,
+                   const allocator_type& alloc = {})
+      : id_(other.id_, alloc), size_(other.size_) {}
+  PartitionElement(PartitionElement&& other) noexcept = default;
+  PartitionElement(PartitionElement&& other, const allocator_type& alloc)
+      : id_(std::move(other.id_), alloc), size_(other.size_) {}
+  auto operator=(const PartitionElement& other)
+      -> PartitionElement& = default;
+  auto operator=(PartitionElement&& other) -> PartitionElement& = default;
+
+  auto id() const -> std::string_view { return id_; }
   auto size() const -> uint64_t { return size_; }
 
   // auto operator==(const PartitionElement& other) const -> bool;
@@ -33,7 +50,7 @@ class PartitionElement {
   auto ToString() const -> std::string;
 
  private:
-  std::string id_;
+  std::pmr::string id_;
   uint64_t size_;
 };
 
@@ -14,6 +14,7 @@
 
 #include "core/partition_element.h"
 
+#include <memory_resource>
 #include <set>
 #include <string>
 #include <vector>
@@ -25,17 +26,27 @@ namespace partition {
  * @brief Represents a Partition problem instance.
  *
  * Single Responsibility: Manages the Partition instance data (set A with
- * sizes).
+ * sizes). All storage is taken from the memory resource given on
+ * construction (the default resource unless stated otherwise).
  */
 class PartitionInstance {
  public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  using ElementList = std::pmr::vector<PartitionElement>;
+
+  PartitionInstance() = default;
+  explicit PartitionInstance(const allocator_type& alloc) : elements_(alloc) {}
+
   /**
    * @name Builders
-   * Methods for building the instance.
+   * Methods for building the instance. Prefer PartitionInstanceBuilder when
+   * the number of elements is known up front.
    */
   auto AddElement(const PartitionElement& element) -> void;
+  auto AddElement(PartitionElement&& element) -> void;
 
-  auto SetElements(const std::vector<PartitionElement>& elements) -> void;
+  auto SetElements(const ElementList& elements) -> void;
+  auto SetElements(ElementList&& elements) -> void;
 
   auto SetBinaryDisplayWidth(size_t width) -> void { binary_display_width_ = width; }
 
@@ -43,14 +54,16 @@ class PartitionInstance {
    * @name Getters
    * Methods for accessing instance data.
    */
-  auto elements() const -> const std::vector<PartitionElement>& {
-    return elements_;
-  }
+  auto elements() const -> const ElementList& { return elements_; }
 
   auto total_sum() const -> int64_t { return total_sum_; }
 
   auto size() const -> size_t { return elements_.size(); }
 
+  auto get_allocator() const -> allocator_type {
+    return elements_.get_allocator();
+  }
+
   /**
    * @brief Returns true if the instance is valid.
    * @return true if valid, false otherwise.
@@ -66,12 +79,28 @@ class PartitionInstance {
 
   auto ToString() const -> std::string;
 
+  /**
+   * @brief Approximate bytes held by the element list, including ids too
+   * long for the small string buffer.
+   */
+  auto MemoryFootprint() const -> size_t;
+
  private:
+  friend class PartitionInstanceBuilder;
+
+  /**
+   * @brief Takes ownership of already built storage (used by the builder).
+   * @param elements Elements of the instance.
+   * @param total_sum Precomputed sum of the element sizes.
+   */
+  PartitionInstance(ElementList&& elements, int64_t total_sum,
+                    size_t binary_display_width);
+
   auto RecalculateTotalSum() -> void;
   auto ToBinaryString(uint64_t value, size_t min_width = 0) const -> std::string;
   
-  std::vector<PartitionElement> elements_;
-  int64_t total_sum_;
+  ElementList elements_;
+  int64_t total_sum_ = 0;
   size_t binary_display_width_ = 0;
 };
 
@@ -0,0 +1,83 @@
+#ifndef PARTITION_INCLUDE_PARTITION_INSTANCE_BUILDER_H_
+#define PARTITION_INCLUDE_PARTITION_INSTANCE_BUILDER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionInstanceBuilder class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+
+namespace partition {
+
+/**
+ * @brief Incrementally builds a PartitionInstance without extra copies.
+ *
+ * Keeps a running total so every insertion is O(1), and Build() moves the
+ * accumulated storage into the resulting instance. Everything is allocated
+ * from the memory resource given on construction.
+ */
+class PartitionInstanceBuilder {
+ public:
+  explicit PartitionInstanceBuilder(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : elements_(resource) {}
+
+  /**
+   * @brief Reserves storage for the expected number of elements.
+   * @param n Expected number of elements.
+   */
+  auto Reserve(size_t n) -> void { elements_.reserve(n); }
+
+  auto AddElement(const PartitionElement& element) -> void;
+  auto AddElement(PartitionElement&& element) -> void;
+
+  /**
+   * @brief Constructs an element in place.
+   * @param args Arguments forwarded to the PartitionElement constructor.
+   * @return Reference to the new element.
+   */
+  template <typename... Args>
+  auto EmplaceElement(Args&&... args) -> const PartitionElement& {
+    const auto& element = elements_.emplace_back(std::forward<Args>(args)...);
+    total_sum_ += element.size();
+    return element;
+  }
+
+  auto SetBinaryDisplayWidth(size_t width) -> void {
+    binary_display_width_ = width;
+  }
+
+  auto total_sum() const -> int64_t { return total_sum_; }
+  auto size() const -> size_t { return elements_.size(); }
+  auto resource() const -> std::pmr::memory_resource* {
+    return elements_.get_allocator().resource();
+  }
+
+  /**
+   * @brief Moves the accumulated elements into a new instance.
+   *
+   * The builder is left empty and can be reused.
+   * @return The built instance.
+   */
+  auto Build() -> PartitionInstance;
+
+ private:
+  PartitionInstance::ElementList elements_;
+  int64_t total_sum_ = 0;
+  size_t binary_display_width_ = 0;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARTITION_INSTANCE_BUILDER_H_
@@ -0,0 +1,167 @@
+#ifndef PARTITION_INCLUDE_REDUCED_PARTITION_INSTANCE_H_
+#define PARTITION_INCLUDE_REDUCED_PARTITION_INSTANCE_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ReducedPartitionInstance class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "core/wide_unsigned.h"
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace partition {
+
+/**
+ * @brief Compact form of a Partition instance produced by the 3DM reduction.
+ *
+ * Every triple element a_i has exactly three set bits, so it is stored as
+ * three bit positions (16-bit when 3qp fits, 32-bit otherwise) instead of a
+ * full integer. The filler elements b1 = 2T - B and b2 = T + B are functions
+ * of q, p and the total T of the a_i and are never stored. Sizes are
+ * expanded on demand.
+ *
+ * Element order matches ThreeDMToPartitionReducer::Reduce: a_0 .. a_{k-1},
+ * then b1 and b2.
+ */
+class ReducedPartitionInstance {
+ public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  using Positions = std::array<uint32_t, 3>;
+
+  /**
+   * @param q Size of each 3DM set.
+   * @param p Bits per field, ceil(log2(k + 1)).
+   * @param alloc Allocator for the position storage.
+   */
+  ReducedPartitionInstance(size_t q, size_t p,
+                           const allocator_type& alloc = {});
+
+  /**
+   * @brief Reserves storage for the expected number of triples.
+   */
+  auto Reserve(size_t k) -> void;
+
+  /**
+   * @brief Appends a triple element a_i = 2^w + 2^x + 2^y.
+   * @param positions Bit positions, each a multiple of p below 3qp.
+   */
+  auto AddTriplePositions(const Positions& positions) -> void;
+
+  auto q() const -> size_t { return q_; }
+  auto p() const -> size_t { return p_; }
+
+  /**
+   * @brief Number of triple elements (k).
+   */
+  auto triple_count() const -> size_t { return position_count_ / 3; }
+
+  /**
+   * @brief Number of Partition elements (k + 2).
+   */
+  auto size() const -> size_t { return triple_count() + 2; }
+
+  /**
+   * @brief Width in bits of each a_i, 3qp.
+   */
+  auto bit_width() const -> size_t { return 3 * q_ * p_; }
+
+  auto uses_narrow_positions() const -> bool { return narrow_; }
+
+  auto positions(size_t i) const -> Positions;
+
+  /**
+   * @brief Number of a_i with a bit set in field slot (bit position / p).
+   */
+  auto slot_count(size_t slot) const -> uint32_t { return slot_counts_[slot]; }
+
+  /**
+   * @brief Returns true if some field slot has no a_i, i.e. the 3DM
+   * instance leaves an element uncovered and has no perfect matching.
+   * Every instance where b1 = 2T - B would be negative is one of these.
+   */
+  auto HasUncoveredSlot() const -> bool;
+
+  /**
+   * @brief Returns true if b1 = 2T - B would be negative, so ElementSize
+   * throws for b1 and the instance cannot be expanded or written.
+   */
+  auto FillerUnderflows() const -> bool;
+
+  auto ElementId(size_t index) const -> std::string;
+
+  /**
+   * @brief Parses an element id back to its index.
+   * @return The index, or std::nullopt if the id is not in the instance.
+   */
+  auto IndexOf(std::string_view id) const -> std::optional<size_t>;
+
+  /**
+   * @brief Expands the size of the element at the given index.
+   */
+  auto ElementSize(size_t index) const -> WideUnsigned;
+
+  /**
+   * @brief T, the sum of the a_i.
+   */
+  auto TripleTotal() const -> WideUnsigned;
+
+  /**
+   * @brief B, the sum of 2^(p*i) for i in [0, 3q).
+   */
+  auto FieldBase() const -> WideUnsigned;
+
+  /**
+   * @brief Sum of every element size (4T).
+   */
+  auto TotalSum() const -> WideUnsigned;
+
+  /**
+   * @brief Returns true if every size and the total fit in PartitionInstance.
+   */
+  auto FitsInPartitionInstance() const -> bool;
+
+  /**
+   * @brief Expands into a regular PartitionInstance.
+   * @throws std::overflow_error if the sizes do not fit in 64 bits.
+   */
+  auto ToPartitionInstance() const -> PartitionInstance;
+
+  /**
+   * @brief Approximate bytes held by the compact storage.
+   */
+  auto MemoryFootprint() const -> size_t;
+
+  /**
+   * @brief MemoryFootprint() of the reduction of an instance with the given
+   * q and k.
+   */
+  static auto EstimateFootprint(size_t q, size_t k) -> size_t;
+
+  auto ToString() const -> std::string;
+
+ private:
+  size_t q_;
+  size_t p_;
+  bool narrow_;
+  size_t position_count_ = 0;
+  std::pmr::vector<uint16_t> narrow_positions_;
+  std::pmr::vector<uint32_t> wide_positions_;
+  std::pmr::vector<uint32_t> slot_counts_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_REDUCED_PARTITION_INSTANCE_H_
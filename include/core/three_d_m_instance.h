@@ -12,7 +12,8 @@
  * @date 11-12-2025
  */
 
-#include <string>
+#include <functional>
+#include <memory_resource>
 #include <set>
 #include <string>
 #include <vector>
@@ -21,24 +22,53 @@
 
 namespace partition {
 
+/**
+ * @brief Dimensions of a 3DM instance, known before it is parsed.
+ */
+struct ThreeDMShape {
+  size_t q = 0;
+  size_t k = 0;
+  size_t name_length = 0;  ///< Average length of an element name.
+};
+
 /**
  * @brief Represents a 3-Dimensional Matching problem instance.
+ *
+ * All storage (set nodes, element names and triples) is taken from the
+ * memory resource given on construction, so a whole instance can live in a
+ * single arena.
  */
 class ThreeDMInstance {
  public:
-  auto SetW(const std::set<std::string>& w) -> void;
-  auto SetX(const std::set<std::string>& x) -> void;
-  auto SetY(const std::set<std::string>& y) -> void;
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  /// Ordered element set; std::less<> allows lookups by std::string_view.
+  using ElementSet = std::pmr::set<std::pmr::string, std::less<>>;
+  using TripleList = std::pmr::vector<Triple>;
+
+  ThreeDMInstance() = default;
+  explicit ThreeDMInstance(const allocator_type& alloc)
+      : w_(alloc), x_(alloc), y_(alloc), m_(alloc) {}
+
+  auto SetW(const ElementSet& w) -> void;
+  auto SetW(ElementSet&& w) -> void;
+  auto SetX(const ElementSet& x) -> void;
+  auto SetX(ElementSet&& x) -> void;
+  auto SetY(const ElementSet& y) -> void;
+  auto SetY(ElementSet&& y) -> void;
   auto SetQ(size_t q) -> void;
   auto AddTriple(const Triple& triple) -> void;
-  auto SetTriples(const std::vector<Triple>& triples) -> void;
+  auto AddTriple(Triple&& triple) -> void;
+  auto SetTriples(const TripleList& triples) -> void;
+  auto SetTriples(TripleList&& triples) -> void;
 
-  auto w() const -> const std::set<std::string>& { return w_; }
-  auto x() const -> const std::set<std::string>& { return x_; }
-  auto y() const -> const std::set<std::string>& { return y_; }
-  auto triples() const -> const std::vector<Triple>& { return m_; }
+  auto w() const -> const ElementSet& { return w_; }
+  auto x() const -> const ElementSet& { return x_; }
+  auto y() const -> const ElementSet& { return y_; }
+  auto triples() const -> const TripleList& { return m_; }
   auto q() const -> size_t { return q_; }
 
+  auto get_allocator() const -> allocator_type { return m_.get_allocator(); }
+
   /**
    * @brief Returns true if the instance is valid (all sets have size q).
    * @return true if valid, false otherwise.
@@ -54,12 +84,31 @@ class ThreeDMInstance {
 
   auto ToString() const -> std::string;
 
+  /**
+   * @brief Approximate bytes held by the sets and the triple list,
+   * including element names too long for the small string buffer.
+   */
+  auto MemoryFootprint() const -> size_t;
+
+  /**
+   * @brief Approximate MemoryFootprint() of an instance not read yet.
+   */
+  static auto EstimateFootprint(const ThreeDMShape& shape) -> size_t;
+
  private:
-  std::set<std::string> w_;
-  std::set<std::string> x_;
-  std::set<std::string> y_;
-  std::vector<Triple> m_;
-  size_t q_;  // Number of elements in each set. 
+  friend class ThreeDMInstanceBuilder;
+
+  /**
+   * @brief Takes ownership of already built storage (used by the builder).
+   */
+  ThreeDMInstance(ElementSet&& w, ElementSet&& x, ElementSet&& y,
+                  TripleList&& m, size_t q);
+
+  ElementSet w_;
+  ElementSet x_;
+  ElementSet y_;
+  TripleList m_;
+  size_t q_ = 0;  // Number of elements in each set.
 };
 
 }  // namespace partition
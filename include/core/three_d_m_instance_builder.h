@@ -0,0 +1,88 @@
+#ifndef PARTITION_INCLUDE_THREE_D_M_INSTANCE_BUILDER_H_
+#define PARTITION_INCLUDE_THREE_D_M_INSTANCE_BUILDER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ThreeDMInstanceBuilder class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+
+#include <memory_resource>
+#include <utility>
+
+namespace partition {
+
+/**
+ * @brief Incrementally builds a ThreeDMInstance without extra copies.
+ *
+ * The sets and triples are accumulated in the builder and moved into the
+ * instance by Build(). Everything is allocated from the memory resource
+ * given on construction.
+ */
+class ThreeDMInstanceBuilder {
+ public:
+  using ElementSet = ThreeDMInstance::ElementSet;
+
+  explicit ThreeDMInstanceBuilder(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : w_(resource), x_(resource), y_(resource), m_(resource) {}
+
+  /**
+   * @brief Reserves storage for the expected number of triples.
+   * @param k Expected number of triples.
+   */
+  auto Reserve(size_t k) -> void { m_.reserve(k); }
+
+  auto SetQ(size_t q) -> void { q_ = q; }
+  auto SetW(ElementSet&& w) -> void { w_ = std::move(w); }
+  auto SetX(ElementSet&& x) -> void { x_ = std::move(x); }
+  auto SetY(ElementSet&& y) -> void { y_ = std::move(y); }
+
+  auto AddTriple(const Triple& triple) -> void { m_.push_back(triple); }
+  auto AddTriple(Triple&& triple) -> void { m_.push_back(std::move(triple)); }
+
+  /**
+   * @brief Constructs a triple in place.
+   * @param args Arguments forwarded to the Triple constructor.
+   * @return Reference to the new triple.
+   */
+  template <typename... Args>
+  auto EmplaceTriple(Args&&... args) -> const Triple& {
+    return m_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  auto w() const -> const ElementSet& { return w_; }
+  auto x() const -> const ElementSet& { return x_; }
+  auto y() const -> const ElementSet& { return y_; }
+  auto resource() const -> std::pmr::memory_resource* {
+    return m_.get_allocator().resource();
+  }
+  auto q() const -> size_t { return q_; }
+  auto size() const -> size_t { return m_.size(); }
+
+  /**
+   * @brief Moves the accumulated sets and triples into a new instance.
+   *
+   * The builder is left empty and can be reused.
+   * @return The built instance.
+   */
+  auto Build() -> ThreeDMInstance;
+
+ private:
+  ElementSet w_;
+  ElementSet x_;
+  ElementSet y_;
+  ThreeDMInstance::TripleList m_;
+  size_t q_ = 0;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_THREE_D_M_INSTANCE_BUILDER_H_
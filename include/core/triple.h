@@ -12,20 +12,40 @@
  * @date 11-12-2025
  */
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 namespace partition {
 
 /**
  * @brief Represents a single triple (w, x, y) in a 3DM instance.
+ *
+ * Allocator-aware: when stored in a std::pmr container the coordinate
+ * strings are allocated from the container's memory resource.
  */
 class Triple {
  public:
-  Triple(const std::string& w, const std::string& x, const std::string& y) : w_(w), x_(x), y_(y) {}
-  
-  auto w() const -> const std::string& { return w_; }
-  auto x() const -> const std::string& { return x_; }
-  auto y() const -> const std::string& { return y_; }
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+  Triple(std::string_view w, std::string_view x, std::string_view y,
+         const allocator_type& alloc = {})
+      : w_(w, alloc), x_(x, alloc), y_(y, alloc) {}
+  Triple(const Triple& other, const allocator_type& alloc = {})
+      : w_(other.w_, alloc), x_(other.x_, alloc), y_(other.y_, alloc) {}
+  Triple(Triple&& other) noexcept = default;
+  Triple(Triple&& other, const allocator_type& alloc)
+      : w_(std::move(other.w_), alloc),
+        x_(std::move(other.x_), alloc),
+        y_(std::move(other.y_), alloc) {}
+  auto operator=(const Triple& other) -> Triple& = default;
+  auto operator=(Triple&& other) -> Triple& = default;
+
+  auto w() const -> std::string_view { return w_; }
+  auto x() const -> std::string_view { return x_; }
+  auto y() const -> std::string_view { return y_; }
+
+  auto get_allocator() const -> allocator_type { return w_.get_allocator(); }
 
   /**
    * @brief Returns true if this triple shares any coordinate with another.
@@ -44,9 +64,9 @@ class Triple {
   auto ToString() const -> std::string;
 
  private:
-  std::string w_;
-  std::string x_;
-  std::string y_;
+  std::pmr::string w_;
+  std::pmr::string x_;
+  std::pmr::string y_;
 };
 
 }  // namespace partition
@@ -0,0 +1,140 @@
+#ifndef PARTITION_INCLUDE_TRIPLE_CONFLICT_INDEX_H_
+#define PARTITION_INCLUDE_TRIPLE_CONFLICT_INDEX_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the TripleConflictIndex class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Which triples of a 3DM instance share an element.
+ *
+ * Elements get dense ids: W first, then X, then Y, each in set order, so
+ * a triple is three ids. For each element the index keeps the sorted list
+ * of triples containing it (in one CSR array), and for up to
+ * max_bitset_triples triples also one conflict bitset per triple. With the
+ * bitsets, "does triple t conflict with this selection of triples" is a
+ * word-wide AND per 64 triples; without them it walks the three posting
+ * lists of t.
+ *
+ * Built in parallel, and read-only afterwards, so any number of threads
+ * may query it. Keeps views of the element names, so the instance must
+ * outlive the index.
+ */
+class TripleConflictIndex {
+ public:
+  using Coordinates = std::array<uint32_t, 3>;
+  using Bitmap = std::vector<uint64_t>;
+
+  /// Bitsets for 8192 triples take 8 MiB; beyond that only posting lists.
+  static constexpr size_t kDefaultMaxBitsetTriples = 8192;
+
+  /**
+   * @param threads Build threads; 0 means std::thread::hardware_concurrency.
+   * @param max_bitset_triples Largest k with per-triple bitsets; 0 never
+   * builds them.
+   * @throws std::out_of_range if a triple names an element outside W, X or
+   * Y.
+   */
+  explicit TripleConflictIndex(
+      const ThreeDMInstance& instance, size_t threads = 0,
+      size_t max_bitset_triples = kDefaultMaxBitsetTriples);
+
+  auto triple_count() const -> size_t { return coordinates_.size(); }
+  auto element_count() const -> size_t { return offsets_.size() - 1; }
+
+  /**
+   * @brief Number of elements of W (set 0), X (1) or Y (2).
+   */
+  auto set_size(size_t set) const -> size_t { return set_sizes_[set]; }
+
+  /**
+   * @brief Dense id of a named element of W (set 0), X (1) or Y (2).
+   */
+  auto ElementId(size_t set, std::string_view name) const
+      -> std::optional<uint32_t>;
+
+  auto coordinates(size_t triple) const -> const Coordinates& {
+    return coordinates_[triple];
+  }
+
+  /**
+   * @brief Triples containing the element, in increasing order.
+   */
+  auto TriplesWith(uint32_t element) const -> std::span<const uint32_t> {
+    return {postings_.data() + offsets_[element],
+            postings_.data() + offsets_[element + 1]};
+  }
+
+  /**
+   * @brief Index in M of a triple with these element ids, if any.
+   */
+  auto FindTriple(const Coordinates& coordinates) const
+      -> std::optional<uint32_t>;
+
+  auto has_bitsets() const -> bool { return !bits_.empty(); }
+
+  /**
+   * @brief Words in a bitmap over the triples.
+   */
+  auto words() const -> size_t { return words_; }
+
+  /**
+   * @brief Triples sharing an element with the given one, not counting
+   * itself. Only with has_bitsets().
+   */
+  auto ConflictRow(size_t triple) const -> std::span<const uint64_t> {
+    return {bits_.data() + triple * words_, words_};
+  }
+
+  /**
+   * @brief true if two different triples share an element.
+   */
+  auto Conflicts(size_t a, size_t b) const -> bool;
+
+  /**
+   * @brief true if the triple shares an element with one of the selected
+   * triples other than itself.
+   * @param selected Bitmap of words() words over the triples.
+   */
+  auto ConflictsWith(size_t triple, const Bitmap& selected) const -> bool;
+
+  /**
+   * @brief Approximate bytes held by the index.
+   */
+  auto MemoryFootprint() const -> size_t;
+
+ private:
+  using NameIndex = std::unordered_map<std::string_view, uint32_t>;
+
+  std::array<size_t, 3> set_sizes_;
+  std::array<NameIndex, 3> names_;
+  std::vector<Coordinates> coordinates_;
+  std::vector<uint32_t> offsets_;   ///< element_count() + 1 entries.
+  std::vector<uint32_t> postings_;  ///< 3k triple indices.
+  size_t words_;
+  std::vector<uint64_t> bits_;  ///< words_ per triple, or empty.
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_TRIPLE_CONFLICT_INDEX_H_
@@ -0,0 +1,96 @@
+#ifndef PARTITION_INCLUDE_WEIGHT_WIDTH_H_
+#define PARTITION_INCLUDE_WEIGHT_WIDTH_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the fixed weight widths and their dispatcher.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace partition {
+
+/// 128-bit weights; a GCC/Clang extension, hence the marker for -Wpedantic.
+__extension__ typedef unsigned __int128 Uint128;
+
+/**
+ * @brief Narrowest unsigned type able to hold every weight and the total
+ * of an instance; kMultiLimb when none of the fixed widths is enough.
+ */
+enum class WeightWidth { k32, k64, k128, kMultiLimb };
+
+/**
+ * @brief True for the unsigned types usable as weights.
+ */
+template <typename Weight>
+inline constexpr bool kIsFixedWeight = std::is_same_v<Weight, uint32_t> ||
+                                       std::is_same_v<Weight, uint64_t> ||
+                                       std::is_same_v<Weight, Uint128>;
+
+template <typename Weight>
+inline constexpr size_t kWeightBits = sizeof(Weight) * 8;
+
+/**
+ * @param bits Bits needed by the largest value (usually the total sum).
+ */
+constexpr auto WeightWidthFor(size_t bits) -> WeightWidth {
+  if (bits <= kWeightBits<uint32_t>) {
+    return WeightWidth::k32;
+  }
+  if (bits <= kWeightBits<uint64_t>) {
+    return WeightWidth::k64;
+  }
+  if (bits <= kWeightBits<Uint128>) {
+    return WeightWidth::k128;
+  }
+  return WeightWidth::kMultiLimb;
+}
+
+constexpr auto WeightWidthName(WeightWidth width) -> const char* {
+  switch (width) {
+    case WeightWidth::k32:
+      return "uint32";
+    case WeightWidth::k64:
+      return "uint64";
+    case WeightWidth::k128:
+      return "uint128";
+    case WeightWidth::kMultiLimb:
+      return "multi-limb";
+  }
+  return "unknown";
+}
+
+/**
+ * @brief Calls visitor(std::type_identity<Weight>{}) with the type of a
+ * fixed width, so the visitor body is instantiated once per width and the
+ * width is decided a single time per instance.
+ * @throws std::invalid_argument for WeightWidth::kMultiLimb.
+ */
+template <typename Visitor>
+auto VisitWeightWidth(WeightWidth width, Visitor&& visitor)
+    -> decltype(visitor(std::type_identity<uint64_t>{})) {
+  switch (width) {
+    case WeightWidth::k32:
+      return visitor(std::type_identity<uint32_t>{});
+    case WeightWidth::k64:
+      return visitor(std::type_identity<uint64_t>{});
+    case WeightWidth::k128:
+      return visitor(std::type_identity<Uint128>{});
+    case WeightWidth::kMultiLimb:
+      break;
+  }
+  throw std::invalid_argument("No fixed-width weight type for this instance");
+}
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WEIGHT_WIDTH_H_
@@ -0,0 +1,127 @@
+#ifndef PARTITION_INCLUDE_WEIGHTED_PARTITION_H_
+#define PARTITION_INCLUDE_WEIGHTED_PARTITION_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the WeightedPartition class template.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/reduced_partition_instance.h"
+#include "core/weight_width.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Reduced Partition instance with its sizes expanded into a fixed
+ * width unsigned type.
+ *
+ * Elements are a_0..a_{k-1}, then b1 and b2, with the same ids as
+ * ReducedPartitionInstance. Sizes are a plain array, so kernels over it
+ * do no id lookups and no width checks.
+ * @tparam Weight uint32_t, uint64_t or Uint128; wide enough for the total.
+ */
+template <typename Weight>
+class WeightedPartition {
+  static_assert(kIsFixedWeight<Weight>, "Weight must be a fixed weight type");
+
+ public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  using WeightList = std::pmr::vector<Weight>;
+
+  /**
+   * @param triple_count Number of a_i elements (k).
+   * @param alloc Allocator for the weights.
+   */
+  explicit WeightedPartition(size_t triple_count,
+                             const allocator_type& alloc = {})
+      : triple_count_(triple_count), weights_(alloc) {
+    weights_.reserve(triple_count + 2);
+  }
+
+  auto AddWeight(Weight weight) -> void {
+    weights_.push_back(weight);
+    total_ += weight;
+  }
+
+  /**
+   * @brief Appends b1 = 2T - B and b2 = T + B once every a_i was added,
+   * where T is their sum and B the sum of 2^(p*i) for i in [0, 3q).
+   * @throws std::underflow_error if b1 would be negative.
+   */
+  auto AddFillers(size_t q, size_t p) -> void {
+    Weight triple_total = total_;
+    Weight field_base = 0;
+    for (size_t slot = 0; slot < 3 * q; ++slot) {
+      field_base += Weight{1} << (slot * p);
+    }
+    if (2 * triple_total < field_base) {
+      throw std::underflow_error(
+          "b1 would be negative: the triples do not cover W, X and Y");
+    }
+    AddWeight(2 * triple_total - field_base);
+    AddWeight(triple_total + field_base);
+  }
+
+  auto weights() const -> const WeightList& { return weights_; }
+  auto weight(size_t index) const -> Weight { return weights_[index]; }
+  auto total() const -> Weight { return total_; }
+  auto size() const -> size_t { return weights_.size(); }
+  auto triple_count() const -> size_t { return triple_count_; }
+
+  auto ElementId(size_t index) const -> std::string {
+    if (index < triple_count_) {
+      return "a_" + std::to_string(index);
+    }
+    return index == triple_count_ ? "b1" : "b2";
+  }
+
+ private:
+  size_t triple_count_;
+  WeightList weights_;
+  Weight total_ = 0;
+};
+
+/**
+ * @brief Expands the sizes of a compact reduced instance.
+ * @throws std::overflow_error if the total needs more bits than Weight.
+ * @throws std::underflow_error if b1 would be negative.
+ */
+template <typename Weight>
+auto ExpandWeights(const ReducedPartitionInstance& reduced,
+                   const std::pmr::polymorphic_allocator<>& alloc = {})
+    -> WeightedPartition<Weight> {
+  // The total is 4T with T below 2^(3qp).
+  if (reduced.bit_width() + 2 > kWeightBits<Weight>) {
+    throw std::overflow_error(
+        "Reduced sizes need " + std::to_string(reduced.bit_width() + 2) +
+        " bits, more than the " + std::to_string(kWeightBits<Weight>) +
+        " of the weight type");
+  }
+  size_t k = reduced.triple_count();
+  WeightedPartition<Weight> weighted(k, alloc);
+  for (size_t i = 0; i < k; ++i) {
+    Weight size = 0;
+    for (uint32_t position : reduced.positions(i)) {
+      size += Weight{1} << position;
+    }
+    weighted.AddWeight(size);
+  }
+  weighted.AddFillers(reduced.q(), reduced.p());
+  return weighted;
+}
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WEIGHTED_PARTITION_H_
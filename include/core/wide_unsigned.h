@@ -0,0 +1,110 @@
+#ifndef PARTITION_INCLUDE_WIDE_UNSIGNED_H_
+#define PARTITION_INCLUDE_WIDE_UNSIGNED_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the WideUnsigned class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Arbitrary width unsigned integer stored as 64-bit limbs.
+ *
+ * Only the operations the reduction and the solution counters need are
+ * provided: adding powers of two, addition, subtraction, multiplication by
+ * a 64-bit factor, shifting, comparison and conversion to text.
+ */
+class WideUnsigned {
+ public:
+  WideUnsigned() = default;
+  explicit WideUnsigned(uint64_t value);
+
+  /**
+   * @brief Returns 2^exponent.
+   * @param exponent Exponent of the power of two.
+   */
+  static auto Pow2(size_t exponent) -> WideUnsigned;
+
+  /**
+   * @brief Builds a value from little-endian limbs.
+   */
+  static auto FromLimbs(std::vector<uint64_t> limbs) -> WideUnsigned;
+
+  /**
+   * @brief Adds 2^exponent in place.
+   * @param exponent Exponent of the power of two.
+   */
+  auto AddPow2(size_t exponent) -> void;
+
+  auto operator+=(const WideUnsigned& other) -> WideUnsigned&;
+
+  /**
+   * @brief Subtracts other in place.
+   * @throws std::underflow_error if other is greater than this value.
+   */
+  auto operator-=(const WideUnsigned& other) -> WideUnsigned&;
+
+  auto operator*=(uint64_t factor) -> WideUnsigned&;
+
+  auto operator<<=(size_t bits) -> WideUnsigned&;
+
+  auto operator<=>(const WideUnsigned& other) const -> std::strong_ordering;
+  auto operator==(const WideUnsigned& other) const -> bool {
+    return limbs_ == other.limbs_;
+  }
+
+  /**
+   * @brief Returns the number of significant bits (0 for zero).
+   */
+  auto BitWidth() const -> size_t;
+
+  auto IsZero() const -> bool { return limbs_.empty(); }
+  auto FitsInUint64() const -> bool { return limbs_.size() <= 1; }
+
+  /**
+   * @brief Returns the value as a 64-bit integer.
+   * @throws std::overflow_error if the value does not fit.
+   */
+  auto ToUint64() const -> uint64_t;
+
+  auto ToDecimalString() const -> std::string;
+  auto ToBinaryString(size_t min_width = 0) const -> std::string;
+
+  /**
+   * @brief Little-endian limbs without leading zero limbs.
+   */
+  auto limbs() const -> const std::vector<uint64_t>& { return limbs_; }
+
+ private:
+  auto Normalize() -> void;
+
+  std::vector<uint64_t> limbs_;
+};
+
+inline auto operator+(WideUnsigned lhs, const WideUnsigned& rhs)
+    -> WideUnsigned {
+  lhs += rhs;
+  return lhs;
+}
+
+inline auto operator-(WideUnsigned lhs, const WideUnsigned& rhs)
+    -> WideUnsigned {
+  lhs -= rhs;
+  return lhs;
+}
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WIDE_UNSIGNED_H_
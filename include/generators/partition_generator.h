@@ -0,0 +1,79 @@
+#ifndef PARTITION_INCLUDE_PARTITION_GENERATOR_H_
+#define PARTITION_INCLUDE_PARTITION_GENERATOR_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionGenerator class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstdint>
+#include <ostream>
+
+namespace partition {
+
+struct PartitionGeneratorOptions {
+  enum class Sizes {
+    kUniform,     ///< Uniform in [min_size, max_size].
+    kLogUniform,  ///< Uniform exponent: many small sizes, a few huge ones.
+    kClustered,   ///< Within 1% of max_size, the hard regime for heuristics.
+  };
+
+  enum class Answer {
+    kRandom,      ///< No guarantee.
+    kSolvable,    ///< An equal split is planted.
+    kUnsolvable,  ///< The total is odd, so no equal split exists.
+  };
+
+  uint64_t n = 10;
+  uint64_t min_size = 1;
+  uint64_t max_size = 1000;
+  uint64_t seed = 1;
+  Sizes sizes = Sizes::kUniform;
+  Answer answer = Answer::kSolvable;
+};
+
+/**
+ * @brief Streams random Partition instances in the text format.
+ *
+ * Elements are named el0..el(n-1), like the shipped instances.
+ *
+ * Solvable: each of the first n-2 elements joins the lighter of two sides
+ * as it is drawn; the last two sizes s and s + d, where d is the gap
+ * between the sides, go to the heavier and lighter side. Both sides then
+ * match, and the gap never exceeds max_size, so the last size does not
+ * exceed 2 * max_size.
+ *
+ * Unsolvable: the last size is incremented when needed to make the total
+ * odd, so it may reach max_size + 1.
+ */
+class PartitionGenerator {
+ public:
+  /**
+   * @throws std::invalid_argument if the options are inconsistent (n below
+   * 2 for kSolvable, an empty size range, or totals beyond 62 bits).
+   */
+  explicit PartitionGenerator(PartitionGeneratorOptions options);
+
+  /**
+   * @brief Writes the instance.
+   * @param output Receives the instance.
+   * @param answer If not null and a split was planted, receives the ids of
+   * one side, one per line.
+   * @throws std::runtime_error if writing fails.
+   */
+  auto Generate(std::ostream& output, std::ostream* answer = nullptr) const
+      -> void;
+
+ private:
+  PartitionGeneratorOptions options_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARTITION_GENERATOR_H_
@@ -0,0 +1,69 @@
+#ifndef PARTITION_INCLUDE_RANDOM_SOURCE_H_
+#define PARTITION_INCLUDE_RANDOM_SOURCE_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the RandomSource class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Seedable xoshiro256** generator with its own bounded and real
+ * sampling.
+ *
+ * The standard distributions are implementation-defined, so the same seed
+ * may give different instances with another standard library. Everything
+ * here is specified bit for bit, so a seed names one instance everywhere.
+ */
+class RandomSource {
+ public:
+  explicit RandomSource(uint64_t seed);
+
+  auto Next() -> uint64_t;
+
+  /**
+   * @return Uniform value in [0, bound), bound > 0 (Lemire's method).
+   */
+  auto Below(uint64_t bound) -> uint64_t;
+
+  /**
+   * @return Uniform value in [low, high].
+   */
+  auto Between(uint64_t low, uint64_t high) -> uint64_t;
+
+  /**
+   * @return Uniform double in [0, 1).
+   */
+  auto Unit() -> double;
+
+  /**
+   * @brief Fisher-Yates shuffle.
+   */
+  template <typename T>
+  auto Shuffle(std::vector<T>& values) -> void {
+    for (size_t i = values.size(); i > 1; --i) {
+      auto j = static_cast<size_t>(Below(i));
+      using std::swap;
+      swap(values[i - 1], values[j]);
+    }
+  }
+
+ private:
+  uint64_t state_[4];
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_RANDOM_SOURCE_H_
@@ -0,0 +1,91 @@
+#ifndef PARTITION_INCLUDE_THREE_D_M_GENERATOR_H_
+#define PARTITION_INCLUDE_THREE_D_M_GENERATOR_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ThreeDMGenerator class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace partition {
+
+struct ThreeDMGeneratorOptions {
+  /**
+   * @brief How often each element is picked by the random triples.
+   */
+  enum class Degree {
+    kUniform,  ///< Every element equally likely.
+    kZipf,     ///< Element i picked with weight 1 / i^zipf_exponent.
+    kRegular,  ///< Degrees differ by at most one inside each set.
+  };
+
+  /**
+   * @brief What is known about the answer.
+   */
+  enum class Answer {
+    kRandom,      ///< No guarantee; elements may even be left uncovered.
+    kPlanted,     ///< A perfect matching is hidden among the triples.
+    kNoMatching,  ///< Every element is covered but no matching exists.
+  };
+
+  enum class Format { kText, kBinary };
+
+  uint64_t q = 3;
+  uint64_t k = 6;
+  uint64_t seed = 1;
+  Degree degree = Degree::kUniform;
+  double zipf_exponent = 1.0;
+  Answer answer = Answer::kPlanted;
+  Format format = Format::kText;
+};
+
+/**
+ * @brief Streams random 3DM instances straight to a stream.
+ *
+ * Triples are produced one at a time, so memory stays O(q) whatever k is.
+ * Elements are named w1..wq, x1..xq and y1..yq in both formats (the binary
+ * reader uses the same names). Output is a pure function of the options.
+ *
+ * Planted: q positions among the k triples are picked by selection
+ * sampling and hold the triples (w_i, x_sigma(i), y_tau(i)) for random
+ * permutations sigma and tau.
+ *
+ * No matching: the same backbone covers every element, but x_sigma(1) and
+ * x_sigma(2) are only ever paired with w1. A matching would need two
+ * triples holding w1, so none exists.
+ */
+class ThreeDMGenerator {
+ public:
+  /**
+   * @throws std::invalid_argument if the options are inconsistent (q = 0,
+   * k < q for kPlanted, q < 3 or k < q + 1 for kNoMatching, q or k beyond
+   * 32 bits for binary output, or a negative Zipf exponent).
+   */
+  explicit ThreeDMGenerator(ThreeDMGeneratorOptions options);
+
+  /**
+   * @brief Writes the instance.
+   * @param output Receives the instance.
+   * @param answer If not null and a matching was planted, receives its
+   * triples as "w x y" lines in output order.
+   * @throws std::runtime_error if writing fails.
+   */
+  auto Generate(std::ostream& output, std::ostream* answer = nullptr) const
+      -> void;
+
+ private:
+  ThreeDMGeneratorOptions options_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_THREE_D_M_GENERATOR_H_
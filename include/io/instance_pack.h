@@ -0,0 +1,78 @@
+#ifndef PARTITION_INCLUDE_INSTANCE_PACK_H_
+#define PARTITION_INCLUDE_INSTANCE_PACK_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Definitions shared by the instance pack reader and writer.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace partition {
+
+/**
+ * Pack layout (integers little-endian):
+ *   - Header: magic "PARTPACK", u32 version, u32 zero
+ *   - Payloads: the instance files, byte for byte, back to back
+ *   - Index: per entry u32 name length, name, u8 kind, u64 offset,
+ *     u64 length, u64 FNV-1a hash of the payload
+ *   - Trailer: u64 index offset, u64 entry count, magic "PACKEND\0"
+ *
+ * The trailer has a fixed size, so a reader finds the index from the end
+ * of the file without touching the payloads.
+ */
+inline constexpr char kPackMagic[8] = {'P', 'A', 'R', 'T', 'P', 'A', 'C', 'K'};
+inline constexpr char kPackEndMagic[8] = {'P', 'A', 'C', 'K', 'E', 'N', 'D', '\0'};
+inline constexpr uint32_t kPackVersion = 1;
+inline constexpr size_t kPackHeaderSize = 16;
+inline constexpr size_t kPackTrailerSize = 24;
+
+/**
+ * @brief Format of an instance stored in a pack.
+ */
+enum class PackEntryKind : uint8_t {
+  kThreeDMText = 1,
+  kThreeDMBinary = 2,
+  kPartitionText = 3,
+};
+
+struct PackEntry {
+  std::string name;
+  PackEntryKind kind = PackEntryKind::kThreeDMText;
+  uint64_t offset = 0;
+  uint64_t length = 0;
+  uint64_t hash = 0;
+};
+
+/**
+ * @brief 64-bit FNV-1a hash used to detect corrupted payloads.
+ */
+auto PackHash(std::string_view data) -> uint64_t;
+
+/**
+ * @brief Parses the trailer and index of a pack held in memory.
+ * @throws std::runtime_error if the data is not a well-formed pack.
+ */
+auto ParsePackIndex(std::string_view pack) -> std::vector<PackEntry>;
+
+/**
+ * @brief Serializes an index followed by the trailer.
+ * @param index_offset Position of the index in the file.
+ */
+auto SerializePackIndex(const std::vector<PackEntry>& entries,
+                        uint64_t index_offset) -> std::string;
+
+auto PackEntryKindName(PackEntryKind kind) -> std::string;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_INSTANCE_PACK_H_
@@ -0,0 +1,105 @@
+#ifndef PARTITION_INCLUDE_INSTANCE_PACK_READER_H_
+#define PARTITION_INCLUDE_INSTANCE_PACK_READER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the InstancePackReader class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "core/three_d_m_instance.h"
+#include "io/instance_pack.h"
+
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Random access to the instances of a pack file.
+ *
+ * The file is memory-mapped once; opening it reads only the trailer and
+ * the index, and each instance is parsed straight from the mapping when
+ * requested. All accessors are const and safe to call from several
+ * threads at once.
+ */
+class InstancePackReader {
+ public:
+  /**
+   * @throws std::runtime_error if the file cannot be mapped or is not a
+   * well-formed pack.
+   */
+  explicit InstancePackReader(const std::string& filename);
+  ~InstancePackReader();
+
+  InstancePackReader(const InstancePackReader&) = delete;
+  auto operator=(const InstancePackReader&) -> InstancePackReader& = delete;
+
+  /**
+   * @brief Tells whether a file starts with the pack magic.
+   */
+  static auto IsPack(const std::string& filename) -> bool;
+
+  auto size() const -> size_t { return entries_.size(); }
+  auto entries() const -> const std::vector<PackEntry>& { return entries_; }
+  auto entry(size_t index) const -> const PackEntry& {
+    return entries_.at(index);
+  }
+
+  /**
+   * @return Index of the entry with that name, if any.
+   */
+  auto Find(std::string_view name) const -> std::optional<size_t>;
+
+  /**
+   * @return The stored bytes of an entry, pointing into the mapping.
+   */
+  auto Payload(size_t index) const -> std::string_view;
+
+  /**
+   * @return true if the payload still matches its stored hash.
+   */
+  auto Verify(size_t index) const -> bool;
+
+  /**
+   * @brief Parses a 3DM entry (text or binary).
+   * @throws std::runtime_error if the entry holds a Partition instance.
+   */
+  auto ReadThreeDM(size_t index, std::pmr::memory_resource* resource =
+                                     std::pmr::get_default_resource()) const
+      -> ThreeDMInstance;
+
+  /**
+   * @brief Reads the shape of a 3DM entry without building it.
+   * @throws std::runtime_error if the entry is not a 3DM instance.
+   */
+  auto ReadThreeDMShape(size_t index) const -> ThreeDMShape;
+
+  /**
+   * @brief Parses a Partition entry.
+   * @throws std::runtime_error if the entry holds a 3DM instance.
+   */
+  auto ReadPartition(size_t index, std::pmr::memory_resource* resource =
+                                       std::pmr::get_default_resource()) const
+      -> PartitionInstance;
+
+ private:
+  const char* data_ = nullptr;
+  size_t length_ = 0;
+  std::vector<PackEntry> entries_;
+  std::unordered_map<std::string_view, size_t> by_name_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_INSTANCE_PACK_READER_H_
@@ -0,0 +1,87 @@
+#ifndef PARTITION_INCLUDE_INSTANCE_PACK_WRITER_H_
+#define PARTITION_INCLUDE_INSTANCE_PACK_WRITER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the InstancePackWriter class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/instance_pack.h"
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Builds or extends a pack file.
+ *
+ * Payloads are streamed to disk as they are added and the index is kept
+ * in memory until Finish. Appending to an existing pack only reads its
+ * index: new payloads overwrite the old index, and Finish writes the
+ * combined one.
+ */
+class InstancePackWriter {
+ public:
+  enum class Mode { kCreate, kAppend };
+
+  /**
+   * @param filename Pack to write.
+   * @param mode kCreate truncates; kAppend extends an existing pack, or
+   * creates it if the file does not exist.
+   * @throws std::runtime_error if the file cannot be opened or, when
+   * appending, is not a valid pack.
+   */
+  explicit InstancePackWriter(const std::string& filename,
+                              Mode mode = Mode::kCreate);
+
+  /**
+   * @brief Calls Finish; errors are swallowed, so call Finish explicitly
+   * to see them.
+   */
+  ~InstancePackWriter();
+
+  InstancePackWriter(const InstancePackWriter&) = delete;
+  auto operator=(const InstancePackWriter&) -> InstancePackWriter& = delete;
+
+  /**
+   * @brief Appends one instance.
+   * @throws std::runtime_error if the name is already in the pack.
+   */
+  auto Add(const std::string& name, PackEntryKind kind,
+           std::string_view payload) -> void;
+
+  /**
+   * @brief Appends the contents of a file.
+   */
+  auto AddFile(const std::string& name, PackEntryKind kind,
+               const std::string& path) -> void;
+
+  /**
+   * @brief Writes the index and trailer. Further calls do nothing.
+   */
+  auto Finish() -> void;
+
+  auto size() const -> size_t { return entries_.size(); }
+
+ private:
+  std::string filename_;
+  std::fstream file_;
+  std::vector<PackEntry> entries_;
+  std::unordered_set<std::string> names_;
+  uint64_t end_offset_ = 0;
+  bool finished_ = false;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_INSTANCE_PACK_WRITER_H_
@@ -15,6 +15,7 @@
 #include "interfaces/instance_reader.h"
 #include "core/partition_instance.h"
 
+#include <memory_resource>
 #include <string>
 
 namespace partition {
@@ -24,13 +25,23 @@ namespace partition {
  * Expected format:
  *   - Line 1: n (number of elements)
  *   - Line 2+: Element ID and size, one per line as "id size"
+ *
+ * The read instances are allocated from the memory resource given on
+ * construction.
  */
 class PartitionReader : public InstanceReader<PartitionInstance> {
  public:
+  explicit PartitionReader(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : resource_(resource) {}
+
   auto ReadFromFile(const std::string& filename) const
       -> PartitionInstance override;
   auto ReadFromStream(std::istream& input) const -> PartitionInstance override;
   auto GetFormatDescription() const -> std::string override;
+
+ private:
+  std::pmr::memory_resource* resource_;
 };
 
 }  // namespace partition
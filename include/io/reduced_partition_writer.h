@@ -0,0 +1,40 @@
+#ifndef PARTITION_INCLUDE_REDUCED_PARTITION_WRITER_H_
+#define PARTITION_INCLUDE_REDUCED_PARTITION_WRITER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ReducedPartitionWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/reduced_partition_instance.h"
+#include "interfaces/instance_writer.h"
+
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Writes compact reduced instances in the Partition text format.
+ *
+ * The output is identical to PartitionWriter on the expanded instance, but
+ * sizes are expanded one at a time, so instances wider than 64 bits can be
+ * written too.
+ */
+class ReducedPartitionWriter : public InstanceWriter<ReducedPartitionInstance> {
+ public:
+  auto WriteToFile(const ReducedPartitionInstance& instance,
+                   const std::string& filename) const -> void override;
+  auto WriteToStream(const ReducedPartitionInstance& instance,
+                     std::ostream& output) const -> void override;
+  auto GetFormatDescription() const -> std::string override;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_REDUCED_PARTITION_WRITER_H_
@@ -0,0 +1,60 @@
+#ifndef PARTITION_INCLUDE_THREE_D_M_BINARY_READER_H_
+#define PARTITION_INCLUDE_THREE_D_M_BINARY_READER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ThreeDMBinaryReader.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+#include "interfaces/instance_reader.h"
+
+#include <istream>
+#include <memory_resource>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Reads 3DM instances from the compact binary format.
+ *
+ * Format (all integers 32-bit little-endian):
+ *   - Magic "3DMB"
+ *   - q, then k
+ *   - k triples as three 0-based indices (w, x, y), each below q
+ *
+ * Elements are named w1..wq, x1..xq and y1..yq. The header is untrusted:
+ * it is rejected if q is 0 or above k (no perfect matching exists then)
+ * or, on a stream that can seek, if exactly 12 * k bytes do not follow
+ * it. Nothing is allocated from q or k before those checks.
+ */
+class ThreeDMBinaryReader : public InstanceReader<ThreeDMInstance> {
+ public:
+  explicit ThreeDMBinaryReader(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : resource_(resource) {}
+
+  auto ReadFromFile(const std::string& filename) const
+      -> ThreeDMInstance override;
+  auto ReadFromStream(std::istream& input) const -> ThreeDMInstance override;
+  auto GetFormatDescription() const -> std::string override;
+
+  /**
+   * @brief Reads q and k from the header only, with the same checks as
+   * ReadFromStream.
+   */
+  static auto ReadShape(std::istream& input) -> ThreeDMShape;
+
+ private:
+  std::pmr::memory_resource* resource_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_THREE_D_M_BINARY_READER_H_
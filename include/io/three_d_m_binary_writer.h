@@ -0,0 +1,39 @@
+#ifndef PARTITION_INCLUDE_THREE_D_M_BINARY_WRITER_H_
+#define PARTITION_INCLUDE_THREE_D_M_BINARY_WRITER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ThreeDMBinaryWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+#include "interfaces/instance_writer.h"
+
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Writes 3DM instances in the binary format of ThreeDMBinaryReader.
+ *
+ * Elements are written as their 0-based position in the ordered sets, so
+ * element names are not preserved.
+ */
+class ThreeDMBinaryWriter : public InstanceWriter<ThreeDMInstance> {
+ public:
+  auto WriteToFile(const ThreeDMInstance& instance,
+                   const std::string& filename) const -> void override;
+  auto WriteToStream(const ThreeDMInstance& instance,
+                     std::ostream& output) const -> void override;
+  auto GetFormatDescription() const -> std::string override;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_THREE_D_M_BINARY_WRITER_H_
@@ -13,6 +13,7 @@
  */
 
 #include <istream>
+#include <memory_resource>
 
 #include "interfaces/instance_reader.h"
 #include "core/three_d_m_instance.h"
@@ -28,15 +29,33 @@ namespace partition {
  *   - Line 3: X elements (space-separated)
  *   - Line 4: Y elements (space-separated)
  *   - Line 5+: Triples, one per line as "w x y"
+ *
+ * The read instances are allocated from the memory resource given on
+ * construction.
  */
 class ThreeDMReader : public InstanceReader<ThreeDMInstance> {
  public:
+  explicit ThreeDMReader(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : resource_(resource) {}
+
   auto ReadFromFile(const std::string& filename) const
       -> ThreeDMInstance override;
   auto ReadFromStream(std::istream& input) const -> ThreeDMInstance override;
   auto GetFormatDescription() const -> std::string override;
+
+  /**
+   * @brief Scans an instance for q, the number of triples and the average
+   * name length without building it. Lines are counted, not validated.
+   * @throws std::runtime_error if q is missing.
+   */
+  static auto ReadShape(std::istream& input) -> ThreeDMShape;
+  static auto ReadShapeFromFile(const std::string& filename) -> ThreeDMShape;
+
  private:
-  auto FillSetFromLine(std::istream& input, std::set<std::string>& elements, size_t q, const std::string& set_name) const -> void;
+  auto FillSetFromLine(std::istream& input, ThreeDMInstance::ElementSet& elements, size_t q, const std::string& set_name) const -> void;
+
+  std::pmr::memory_resource* resource_;
 };
 
 }  // namespace partition
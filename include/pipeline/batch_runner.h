@@ -0,0 +1,120 @@
+#ifndef PARTITION_INCLUDE_BATCH_RUNNER_H_
+#define PARTITION_INCLUDE_BATCH_RUNNER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the BatchRunner class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+
+#include <functional>
+#include <istream>
+#include <memory_resource>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+class InstancePackReader;
+
+struct BatchOptions {
+  std::string output_dir = ".";
+  size_t threads = 0;  ///< Worker threads; 0 uses every core.
+  /// Bytes the running jobs may need together; 0 disables the budget.
+  size_t memory_budget = 0;
+};
+
+/**
+ * @brief Totals of one batch run.
+ */
+struct BatchSummary {
+  size_t succeeded = 0;
+  size_t failed = 0;
+  size_t refused = 0;  ///< Jobs whose estimate exceeds the whole budget.
+  double wall_ms = 0.0;
+  size_t peak_rss_bytes = 0;
+};
+
+/**
+ * @brief Reduces many 3DM instances in parallel without any console output
+ * besides one JSON-lines record per instance.
+ *
+ * Every instance is an independent task on a work-stealing pool. Each
+ * worker keeps its own reducer and parse arena, reads the instance, reduces
+ * it to the compact form and writes it to
+ * `<output_dir>/<index>-<stem>.partition.txt`. Records are written as
+ * instances finish, so their order follows completion, not input; the
+ * "index" field gives the input position.
+ *
+ * Every record carries the bytes held by the parsed and the reduced
+ * instance, the peak held while reading and while reducing, and the
+ * bytes the job's arena took from the system. With a memory budget, each
+ * job is first scanned for its shape and its memory estimated; jobs wait
+ * until the estimates of the running jobs leave room for theirs, and a job
+ * that could never fit is refused with status "refused".
+ */
+class BatchRunner {
+ public:
+  explicit BatchRunner(BatchOptions options);
+
+  /**
+   * @brief Processes every input and writes one record per line.
+   * @param inputs Paths of the 3DM instances.
+   * @param records Stream receiving the JSON-lines records.
+   */
+  auto Run(const std::vector<std::string>& inputs, std::ostream& records)
+      -> BatchSummary;
+
+  /**
+   * @brief Processes every 3DM entry of a pack. The "input" field of each
+   * record is the entry name; Partition entries are reported as errors.
+   */
+  auto Run(const InstancePackReader& pack, std::ostream& records)
+      -> BatchSummary;
+
+  /**
+   * @brief Expands a batch source into instance paths.
+   * @param source A directory (its regular files, sorted), "-" (one path
+   * per line read from manifest; blank lines and lines starting with '#'
+   * are skipped), or a glob pattern.
+   * @param manifest Stream read when source is "-".
+   * @throws std::runtime_error if the source matches nothing.
+   */
+  static auto CollectInputs(const std::string& source, std::istream& manifest)
+      -> std::vector<std::string>;
+
+  /**
+   * @brief Bytes a job needs to read and reduce an instance of the given
+   * shape: the arena holding the parsed instance (with the slack its
+   * triple list leaves while growing) and the reduced instance, plus the
+   * index maps.
+   */
+  static auto EstimateJobMemory(const ThreeDMShape& shape) -> size_t;
+
+ private:
+  using Loader = std::function<ThreeDMInstance(size_t index,
+                                               std::pmr::memory_resource*)>;
+  using ShapeReader = std::function<ThreeDMShape(size_t index)>;
+
+  /**
+   * @brief Runs count jobs; names[i] labels job i, read_shape sizes it and
+   * load parses it.
+   */
+  auto Execute(const std::vector<std::string>& names, const Loader& load,
+               const ShapeReader& read_shape, std::ostream& records)
+      -> BatchSummary;
+
+  BatchOptions options_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_BATCH_RUNNER_H_
@@ -0,0 +1,152 @@
+#ifndef PARTITION_INCLUDE_BOUNDED_SPSC_QUEUE_H_
+#define PARTITION_INCLUDE_BOUNDED_SPSC_QUEUE_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the BoundedSpscQueue class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer.
+ *
+ * Push waits while the queue is full, which gives backpressure between
+ * pipeline stages. Pop waits until an item arrives or the producer closes
+ * the queue. A waiting side spins briefly, then sleeps on a condition
+ * variable that the other side only touches while someone sleeps on it.
+ * @tparam T Item type; must be default constructible and movable.
+ */
+template <typename T>
+class BoundedSpscQueue {
+ public:
+  /**
+   * @param capacity Maximum number of items held at once.
+   * @throws std::invalid_argument If capacity is 0.
+   */
+  explicit BoundedSpscQueue(size_t capacity)
+      : slots_(CheckCapacity(capacity) + 1) {}
+
+  BoundedSpscQueue(const BoundedSpscQueue&) = delete;
+  auto operator=(const BoundedSpscQueue&) -> BoundedSpscQueue& = delete;
+
+  /**
+   * @brief Appends an item, waiting while the queue is full.
+   */
+  auto Push(T item) -> void {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t next = Next(tail);
+    auto has_space = [&] { return next != head_.load(); };
+    if (!Spin(has_space)) {
+      Sleep(producer_waiting_, space_, has_space);
+    }
+    slots_[tail] = std::move(item);
+    tail_.store(next, std::memory_order_release);
+    Wake(consumer_waiting_, items_);
+  }
+
+  /**
+   * @brief Removes the oldest item, waiting until one is available.
+   * @return The item, or std::nullopt once the queue is closed and drained.
+   */
+  auto Pop() -> std::optional<T> {
+    size_t head = head_.load(std::memory_order_relaxed);
+    auto ready = [&] { return head != tail_.load() || closed_.load(); };
+    if (!Spin(ready)) {
+      Sleep(consumer_waiting_, items_, ready);
+    }
+    // Closed and drained; the producer may have pushed right before closing.
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return std::nullopt;
+    }
+    std::optional<T> item(std::move(slots_[head]));
+    slots_[head] = T();
+    head_.store(Next(head), std::memory_order_release);
+    Wake(producer_waiting_, space_);
+    return item;
+  }
+
+  /**
+   * @brief Signals that no more items will be pushed.
+   */
+  auto Close() -> void {
+    closed_.store(true, std::memory_order_release);
+    Wake(consumer_waiting_, items_);
+  }
+
+ private:
+  static constexpr int kSpinCount = 64;
+
+  static auto CheckCapacity(size_t capacity) -> size_t {
+    if (capacity == 0) {
+      throw std::invalid_argument(
+          "BoundedSpscQueue capacity must be at least 1");
+    }
+    return capacity;
+  }
+
+  auto Next(size_t index) const -> size_t {
+    return index + 1 == slots_.size() ? 0 : index + 1;
+  }
+
+  template <typename Ready>
+  static auto Spin(const Ready& ready) -> bool {
+    for (int spin = 0; spin < kSpinCount; ++spin) {
+      if (ready()) {
+        return true;
+      }
+      std::this_thread::yield();
+    }
+    return ready();
+  }
+
+  // The flag is published before the condition is re-checked under the
+  // mutex, and Wake fences before reading it, so a wake-up is never lost.
+  template <typename Ready>
+  auto Sleep(std::atomic<bool>& waiting, std::condition_variable& cv,
+             const Ready& ready) -> void {
+    std::unique_lock lock(mutex_);
+    waiting.store(true);
+    cv.wait(lock, ready);
+    waiting.store(false, std::memory_order_relaxed);
+  }
+
+  auto Wake(const std::atomic<bool>& waiting, std::condition_variable& cv)
+      -> void {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting.load(std::memory_order_relaxed)) {
+      std::lock_guard lock(mutex_);
+      cv.notify_one();
+    }
+  }
+
+  std::vector<T> slots_;
+  alignas(64) std::atomic<size_t> head_{0};
+  alignas(64) std::atomic<size_t> tail_{0};
+  std::atomic<bool> closed_{false};
+  std::atomic<bool> producer_waiting_{false};
+  std::atomic<bool> consumer_waiting_{false};
+  std::mutex mutex_;
+  std::condition_variable space_;
+  std::condition_variable items_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_BOUNDED_SPSC_QUEUE_H_
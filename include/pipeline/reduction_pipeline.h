@@ -12,13 +12,14 @@
  * @date 11-12-2025
  */
 
-#include "instance_reader.h"
-#include "instance_solver.h"
-#include "instance_writer.h"
-#include "partition_instance.h"
-#include "reduction_strategy.h"
-#include "three_d_m_instance.h"
-#include "triple.h"
+#include "core/partition_instance.h"
+#include "core/three_d_m_instance.h"
+#include "core/triple.h"
+#include "interfaces/instance_reader.h"
+#include "interfaces/instance_solver.h"
+#include "interfaces/instance_writer.h"
+#include "interfaces/reduction_strategy.h"
+#include "reduction/feasibility_precheck.h"
 
 #include <memory>
 #include <optional>
@@ -28,11 +29,72 @@
 
 namespace partition {
 
+/**
+ * @brief One 3DM input file and where to write its reduced instance.
+ */
+struct PipelineJob {
+  std::string three_dm_file;
+  std::string partition_output_file;
+};
+
+/**
+ * @brief Time spent by one job in each stage, in milliseconds.
+ */
+struct JobTimings {
+  double read_ms = 0.0;
+  double precheck_ms = 0.0;
+  double reduce_ms = 0.0;
+  double solve_ms = 0.0;
+  double write_ms = 0.0;
+};
+
+/**
+ * @brief Outcome of one job of a batch.
+ */
+struct PipelineResult {
+  std::string three_dm_file;
+  std::string partition_output_file;
+  bool succeeded = false;
+  /// Set when the precheck proved there is no matching; nothing was
+  /// reduced, solved or written.
+  std::optional<InfeasibilityCertificate> rejection;
+  std::string error;
+  std::string report;
+  JobTimings timings;
+};
+
+/**
+ * @brief Aggregated timing of one pipeline stage over a batch.
+ */
+struct StageMetrics {
+  std::string name;
+  size_t jobs = 0;
+  double busy_ms = 0.0;     ///< Processing jobs.
+  double starved_ms = 0.0;  ///< Waiting for input from the previous stage.
+  double blocked_ms = 0.0;  ///< Waiting for room in the next stage (backpressure).
+};
+
 /**
  * @brief Orchestrates the complete reduction pipeline.
+ *
+ * Batches run as a staged pipeline: reader, reducer, solver and writer each
+ * run on their own thread, connected by bounded lock-free queues, so
+ * reading job N+1 overlaps with reducing job N and solving job N-1.
+ *
+ * Before reducing, the reduce stage runs FeasibilityPrecheck; an instance
+ * it rejects skips the reduction, the solver and the writer, and its
+ * report carries the certificate.
+ *
+ * Every stage uses its collaborator from a single thread. The reduction
+ * strategy is the exception: Reduce runs on the reducer thread while
+ * MapSolutionBack runs on the solver thread, so MapSolutionBack must not
+ * touch state written by Reduce.
  */
 class ReductionPipeline {
  public:
+  /// Default number of jobs buffered between two stages.
+  static constexpr size_t kDefaultQueueCapacity = 8;
+
   ReductionPipeline(
       std::shared_ptr<ReductionStrategy> reduction_strategy,
       std::shared_ptr<InstanceReader<ThreeDMInstance>> three_dm_reader,
@@ -50,6 +112,25 @@ class ReductionPipeline {
   auto Execute(const std::string& three_dm_file,
                const std::string& partition_output_file) -> std::string;
 
+  /**
+   * @brief Executes many jobs through the staged, multi-threaded pipeline.
+   *
+   * Errors are reported per job and do not stop the batch. Stage metrics of
+   * the last batch are available through stage_metrics().
+   * @param jobs Jobs to run.
+   * @param queue_capacity Jobs buffered between two stages.
+   * @return One result per job, in input order.
+   * @throws std::invalid_argument If queue_capacity is 0.
+   */
+  auto ExecuteBatch(const std::vector<PipelineJob>& jobs,
+                    size_t queue_capacity = kDefaultQueueCapacity)
+      -> std::vector<PipelineResult>;
+
+  /**
+   * @brief Enables or disables the precheck (enabled by default).
+   */
+  auto SetPrecheckEnabled(bool enabled) -> void { precheck_enabled_ = enabled; }
+
   /**
    * @brief Performs just the reduction step.
    * @param three_dm The 3DM instance to reduce.
@@ -67,11 +148,32 @@ class ReductionPipeline {
                        const ThreeDMInstance& original_three_dm)
       -> std::optional<std::vector<Triple>>;
 
+  /**
+   * @brief Per-stage metrics of the last ExecuteBatch call.
+   */
+  auto stage_metrics() const -> const std::vector<StageMetrics>& {
+    return stage_metrics_;
+  }
+
+  /**
+   * @brief Summarizes the stage metrics of the last batch: busy time per
+   * stage, throughput and the bottleneck stage.
+   */
+  auto GenerateStageReport() const -> std::string;
+
  private:
+  struct WorkItem;
+
+  auto ReadStage(WorkItem& item) -> void;
+  auto ReduceStage(WorkItem& item) -> void;
+  auto SolveStage(WorkItem& item) -> void;
+  auto WriteStage(WorkItem& item) -> void;
+
   auto GenerateReport(
       const ThreeDMInstance& three_dm, const PartitionInstance& partition,
       const std::optional<std::set<std::string>>& partition_solution,
-      const std::optional<std::vector<Triple>>& three_dm_solution)
+      const std::optional<std::vector<Triple>>& three_dm_solution,
+      const std::string& solver_name, const JobTimings& timings)
       -> std::string;
 
   std::shared_ptr<ReductionStrategy> reduction_strategy_;
@@ -79,6 +181,10 @@ class ReductionPipeline {
   std::shared_ptr<InstanceWriter<PartitionInstance>> partition_writer_;
   std::shared_ptr<InstanceSolver<PartitionInstance, std::set<std::string>>>
       partition_solver_;
+  FeasibilityPrecheck precheck_;
+  bool precheck_enabled_ = true;
+  std::vector<StageMetrics> stage_metrics_;
+  double batch_wall_ms_ = 0.0;
 };
 
 }  // namespace partition
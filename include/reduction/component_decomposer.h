@@ -0,0 +1,73 @@
+#ifndef PARTITION_INCLUDE_COMPONENT_DECOMPOSER_H_
+#define PARTITION_INCLUDE_COMPONENT_DECOMPOSER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ComponentDecomposer class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Independent part of a 3DM instance.
+ */
+struct ThreeDMComponent {
+  /// Elements and triples of the part, with q = |W| of the part.
+  ThreeDMInstance instance;
+  /// Index in the original M of each triple, in order.
+  std::vector<uint32_t> triples;
+};
+
+/**
+ * @brief Splits a 3DM instance into the connected components of its
+ * element-triple incidence graph.
+ *
+ * Two elements are connected when a triple contains both, so no triple
+ * crosses components and the instance has a perfect matching exactly when
+ * every component has one. Components are found with union-find over the
+ * dense element ids of a TripleConflictIndex and come out in order of
+ * their first element (W, then X, then Y, in set order).
+ */
+class ComponentDecomposer {
+ public:
+  /**
+   * @param threads Threads for the element index; 0 means
+   * std::thread::hardware_concurrency.
+   * @param resource Memory resource for the component instances.
+   */
+  explicit ComponentDecomposer(
+      size_t threads = 1,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Every component, including elements in no triple as components
+   * without triples.
+   *
+   * A component can only have a perfect matching if its instance IsValid()
+   * (|W| = |X| = |Y|) and it has at least q triples.
+   * @throws std::out_of_range if a triple names an element outside W, X
+   * or Y.
+   */
+  auto Decompose(const ThreeDMInstance& instance) const
+      -> std::vector<ThreeDMComponent>;
+
+ private:
+  size_t threads_;
+  std::pmr::memory_resource* resource_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_COMPONENT_DECOMPOSER_H_
@@ -0,0 +1,81 @@
+#ifndef PARTITION_INCLUDE_FEASIBILITY_PRECHECK_H_
+#define PARTITION_INCLUDE_FEASIBILITY_PRECHECK_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the FeasibilityPrecheck class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Why a 3DM instance cannot have a perfect matching.
+ */
+struct InfeasibilityCertificate {
+  enum class Reason {
+    kUnequalSets,       ///< |W|, |X| and |Y| are not all q.
+    kTooFewTriples,     ///< k < q.
+    kUncoveredElement,  ///< An element is in no triple.
+    kHallViolation      ///< A projection has no perfect bipartite matching.
+  };
+
+  Reason reason;
+  /// Human-readable explanation naming the offending elements.
+  std::string explanation;
+  /// For kHallViolation: elements S of one set whose triples reach fewer
+  /// than |S| elements of another; for kUncoveredElement: that element.
+  std::vector<std::string> witnesses;
+
+  static auto ReasonName(Reason reason) -> const char*;
+};
+
+/**
+ * @brief Necessary conditions for a perfect 3DM matching, checked in
+ * near-linear time before any reduction.
+ *
+ * A perfect matching needs |W| = |X| = |Y| = q, at least q triples, every
+ * element in some triple, and, for each pair of sets, a perfect matching
+ * in the bipartite graph of the pairs the triples project onto (W-X, W-Y,
+ * X-Y). The last check runs Hopcroft-Karp, and when it fails, Hall's
+ * theorem gives the certificate: the elements reachable by alternating
+ * paths from an unmatched one form a set S with |N(S)| < |S|.
+ *
+ * Passing every check does not mean the instance is solvable.
+ */
+class FeasibilityPrecheck {
+ public:
+  /**
+   * @param threads Threads for the element index and the three
+   * projections; 0 means std::thread::hardware_concurrency.
+   */
+  explicit FeasibilityPrecheck(size_t threads = 1);
+
+  /**
+   * @return A certificate if a necessary condition fails, std::nullopt if
+   * all of them hold.
+   * @throws std::out_of_range if a triple names an element outside W, X
+   * or Y.
+   */
+  auto Check(const ThreeDMInstance& instance) const
+      -> std::optional<InfeasibilityCertificate>;
+
+ private:
+  size_t threads_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_FEASIBILITY_PRECHECK_H_
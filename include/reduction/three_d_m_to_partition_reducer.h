@@ -12,9 +12,15 @@
  * @date 11-12-2025
  */
 
+#include "core/reduced_partition_instance.h"
+#include "core/weighted_partition.h"
 #include "interfaces/reduction_strategy.h"
+#include "util/metrics.h"
 
+#include <cmath>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace partition {
@@ -29,17 +35,64 @@ namespace partition {
  */
 class ThreeDMToPartitionReducer : public ReductionStrategy {
  public:
+  /**
+   * @brief Reduces to a regular PartitionInstance.
+   * @throws std::overflow_error if the sizes need more than 63 bits; use
+   * ReduceCompact for those instances.
+   */
   auto Reduce(const ThreeDMInstance& three_dm) const
       -> PartitionInstance override;
 
+  /**
+   * @brief Reduces to the compact three-bit-position representation.
+   *
+   * Works for any q since sizes are never expanded.
+   * @param three_dm The 3DM instance to reduce.
+   * @return The reduced instance in compact form.
+   */
+  auto ReduceCompact(const ThreeDMInstance& three_dm) const
+      -> ReducedPartitionInstance;
+
+  /**
+   * @brief Reduces straight into sizes of a fixed width.
+   *
+   * Pick Weight with WeightWidthFor(WeightBits(q, k)); the sizes are
+   * computed in Weight arithmetic with no intermediate representation.
+   * @throws std::overflow_error if the total needs more bits than Weight.
+   */
+  template <typename Weight>
+  auto ReduceToWeights(const ThreeDMInstance& three_dm) const
+      -> WeightedPartition<Weight>;
+
+  /**
+   * @brief Bits needed by the total size of the reduction of an instance
+   * with the given q and k.
+   */
+  static auto WeightBits(size_t q, size_t k) -> size_t {
+    return 3 * q * static_cast<size_t>(std::ceil(std::log2(k + 1))) + 2;
+  }
+
   auto MapSolutionBack(const std::set<std::string>& partition_solution,
                        const ThreeDMInstance& original_instance) const
       -> std::vector<Triple> override;
 
   auto GetDescription() const -> std::string override;
 
+  /**
+   * @brief Approximate bytes held by the element index maps of the last
+   * reduction.
+   */
+  auto IndexMemoryFootprint() const -> size_t;
+
+  /**
+   * @brief IndexMemoryFootprint() after reducing an instance of size q.
+   */
+  static auto EstimateIndexFootprint(size_t q) -> size_t;
+
  private:
   auto CalculateWeight(const Triple& triple) const -> uint64_t;
+  auto CalculatePositions(const Triple& triple) const
+      -> ReducedPartitionInstance::Positions;
   auto CreateIndexMaps(const ThreeDMInstance& three_dm) const -> void;
 
   auto CalculateB() const -> uint64_t;
@@ -49,12 +102,40 @@ class ThreeDMToPartitionReducer : public ReductionStrategy {
   }
   mutable size_t q_;
   mutable uint64_t p_;
-  // Index maps for W, X, Y elements
-  mutable std::unordered_map<std::string, size_t> w_indices_;
-  mutable std::unordered_map<std::string, size_t> x_indices_;
-  mutable std::unordered_map<std::string, size_t> y_indices_;
+  // Index maps for W, X, Y elements. Keys view into the instance being
+  // reduced and are only valid during Reduce.
+  mutable std::unordered_map<std::string_view, size_t> w_indices_;
+  mutable std::unordered_map<std::string_view, size_t> x_indices_;
+  mutable std::unordered_map<std::string_view, size_t> y_indices_;
 };
 
+template <typename Weight>
+auto ThreeDMToPartitionReducer::ReduceToWeights(
+    const ThreeDMInstance& three_dm) const -> WeightedPartition<Weight> {
+  q_ = three_dm.q();
+  auto k = three_dm.triples().size();
+  p_ = std::ceil(std::log2(k + 1));
+  if (WeightBits(q_, k) > kWeightBits<Weight>) {
+    throw std::overflow_error(
+        "Reduced sizes need " + std::to_string(WeightBits(q_, k)) +
+        " bits, more than the " + std::to_string(kWeightBits<Weight>) +
+        " of the weight type");
+  }
+  CreateIndexMaps(three_dm);
+  PARTITION_METRICS_PHASE(kWeights);
+  PARTITION_METRICS_COUNT(kTriplesReduced, k);
+  WeightedPartition<Weight> weighted(k, three_dm.get_allocator());
+  for (const auto& triple : three_dm.triples()) {
+    Weight size = 0;
+    for (uint32_t position : CalculatePositions(triple)) {
+      size += Weight{1} << position;
+    }
+    weighted.AddWeight(size);
+  }
+  weighted.AddFillers(q_, p_);
+  return weighted;
+}
+
 }  // namespace partition
 
 #endif  // PARTITION_INCLUDE_THREE_DM_TO_PARTITION_REDUCER_H_
@@ -0,0 +1,62 @@
+#ifndef PARTITION_INCLUDE_FRAME_IO_H_
+#define PARTITION_INCLUDE_FRAME_IO_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the length-prefixed frame protocol.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace partition {
+
+/**
+ * Every frame is an 8-byte header followed by the payload:
+ *   - byte 0: frame type
+ *   - bytes 1-3: zero
+ *   - bytes 4-7: payload length, 32-bit big-endian
+ */
+enum class FrameType : uint8_t {
+  // Requests
+  kThreeDMText = 1,    ///< 3DM instance in the text format.
+  kThreeDMBinary = 2,  ///< 3DM instance in the binary format.
+  kPartitionText = 3,  ///< Partition instance in the text format.
+  // Responses
+  kOk = 0x80,
+  kError = 0x81,
+};
+
+/// Largest payload accepted in a frame.
+inline constexpr uint32_t kMaxFramePayload = uint32_t{1} << 30;
+
+struct Frame {
+  FrameType type = FrameType::kError;
+  std::string payload;
+};
+
+/**
+ * @brief Reads one frame from a socket.
+ * @param fd Connected socket.
+ * @param frame Receives the frame.
+ * @return false on a clean end of stream before a header.
+ * @throws std::runtime_error on I/O errors, truncation or oversized frames.
+ */
+auto ReadFrame(int fd, Frame& frame) -> bool;
+
+/**
+ * @brief Writes one frame to a socket.
+ * @throws std::runtime_error on I/O errors or oversized payloads.
+ */
+auto WriteFrame(int fd, FrameType type, std::string_view payload) -> void;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_FRAME_IO_H_
@@ -0,0 +1,108 @@
+#ifndef PARTITION_INCLUDE_REDUCTION_SERVER_H_
+#define PARTITION_INCLUDE_REDUCTION_SERVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ReductionServer class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "server/frame_io.h"
+#include "solvers/partition_solver.h"
+#include "solvers/solver_cost_model.h"
+#include "util/thread_pool.h"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace partition {
+
+struct ServerOptions {
+  std::string socket_path = "/tmp/partition.sock";
+  size_t threads = 0;          ///< Worker threads; 0 uses every core.
+  size_t cache_entries = 256;  ///< Cached responses; 0 disables the cache.
+  PartitionSolver::Algorithm algorithm = PartitionSolver::Algorithm::kAuto;
+  /// Engine ranking for kAuto; nullptr uses the built-in coefficients.
+  std::shared_ptr<const SolverCostModel> cost_model;
+};
+
+/**
+ * @brief Long-running daemon answering reduction requests over a Unix
+ * domain socket.
+ *
+ * Clients send frames (see frame_io.h) holding a 3DM or Partition instance
+ * and receive one response frame per request, on the same connection.
+ * 3DM instances are reduced, solved and mapped back; Partition instances
+ * are only solved. Workers keep their reducer, solvers and parse arena
+ * warm between requests, and identical requests are served from a bounded
+ * LRU cache.
+ */
+class ReductionServer {
+ public:
+  explicit ReductionServer(ServerOptions options);
+  ~ReductionServer();
+
+  ReductionServer(const ReductionServer&) = delete;
+  auto operator=(const ReductionServer&) -> ReductionServer& = delete;
+
+  /**
+   * @brief Binds the socket and serves until Stop is called.
+   * @throws std::runtime_error if the socket cannot be set up.
+   */
+  auto Run() -> void;
+
+  /**
+   * @brief Asks Run to return. Only touches an atomic flag, so it may be
+   * called from a signal handler.
+   */
+  auto Stop() -> void { stopping_.store(true); }
+
+  /**
+   * @brief Handles one request frame; used by the connections and exposed
+   * so the request path can be driven without a socket.
+   * @return Response frame (kOk or kError).
+   */
+  auto HandleRequest(const Frame& request) -> Frame;
+
+ private:
+  struct WorkerState;
+  struct Connection;
+
+  auto ServeConnection(Connection& connection) -> void;
+  auto ReapConnections(bool all) -> void;
+  auto Process(const Frame& request, WorkerState& state) -> std::string;
+  auto ProcessThreeDM(const Frame& request, WorkerState& state)
+      -> std::string;
+  auto ProcessPartition(const Frame& request, WorkerState& state)
+      -> std::string;
+
+  auto CacheLookup(const std::string& key, std::string& body) -> bool;
+  auto CacheStore(const std::string& key, const std::string& body) -> void;
+
+  ServerOptions options_;
+  ThreadPool pool_;
+  std::vector<std::unique_ptr<WorkerState>> workers_;
+  std::atomic<bool> stopping_{false};
+
+  std::list<std::unique_ptr<Connection>> connections_;
+
+  // LRU cache: most recently used entries at the front of the list.
+  using CacheList = std::list<std::pair<std::string, std::string>>;
+  std::mutex cache_mutex_;
+  CacheList cache_list_;
+  std::unordered_map<std::string, CacheList::iterator> cache_index_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_REDUCTION_SERVER_H_
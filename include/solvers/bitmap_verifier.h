@@ -0,0 +1,143 @@
+#ifndef PARTITION_INCLUDE_BITMAP_VERIFIER_H_
+#define PARTITION_INCLUDE_BITMAP_VERIFIER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionBitmapVerifier and
+ * ThreeDMBitmapVerifier classes.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "core/three_d_m_instance.h"
+#include "core/triple.h"
+#include "core/triple_conflict_index.h"
+
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace partition {
+
+/// Subset of elements as a bitmap: bit i of word i / 64 marks element i.
+using SubsetBitmap = std::vector<uint64_t>;
+
+/**
+ * @brief Partition instance prepared for checking many subsets.
+ *
+ * Sizes are packed in element order and padded to whole bitmap words, so
+ * the subset sum is a branch-free masked sum over each word. Ids are only
+ * looked up when converting a set of ids with ToBitmap. Keeps views of the
+ * ids, so the instance must outlive the verifier.
+ */
+class PartitionBitmapVerifier {
+ public:
+  explicit PartitionBitmapVerifier(const PartitionInstance& instance);
+
+  /**
+   * @return Bitmap of the ids, or std::nullopt if one is not an element.
+   */
+  auto ToBitmap(const std::set<std::string>& subset) const
+      -> std::optional<SubsetBitmap>;
+
+  /**
+   * @return Sum of the sizes marked in the bitmap, or std::nullopt if it
+   * does not have exactly words() words or marks a bit past the last
+   * element.
+   */
+  auto SubsetSum(const SubsetBitmap& subset) const -> std::optional<uint64_t>;
+
+  /**
+   * @return true if the subset adds up to exactly half of the total.
+   */
+  auto Verify(const SubsetBitmap& subset) const -> bool;
+
+  /**
+   * @brief Verifies every candidate, split over threads.
+   * @param threads Number of threads; 0 means
+   * std::thread::hardware_concurrency.
+   * @return 1 for each valid candidate, 0 otherwise, in input order.
+   */
+  auto VerifyBatch(const std::vector<SubsetBitmap>& candidates,
+                   size_t threads = 0) const -> std::vector<uint8_t>;
+
+  /**
+   * @brief As above for sets of ids; the conversion runs on the threads too.
+   */
+  auto VerifyBatch(const std::vector<std::set<std::string>>& candidates,
+                   size_t threads = 0) const -> std::vector<uint8_t>;
+
+  auto size() const -> size_t { return size_; }
+  auto words() const -> size_t { return sizes_.size() / 64; }
+
+ private:
+  size_t size_;
+  uint64_t total_;
+  std::vector<uint64_t> sizes_;  ///< Padded with zeros to words() * 64.
+  std::unordered_map<std::string_view, uint32_t> index_;
+};
+
+/**
+ * @brief 3DM instance prepared for checking many matchings.
+ *
+ * Built on a TripleConflictIndex (without conflict bitsets): elements have
+ * dense ids and every triple of M is three of them. A matching given as
+ * triple indices is checked with one coverage bitset over W, X and Y and
+ * no string work at all. Keeps views of the element names, so the
+ * instance must outlive the verifier.
+ */
+class ThreeDMBitmapVerifier {
+ public:
+  /**
+   * @throws std::out_of_range if a triple names an element outside W, X
+   * or Y.
+   */
+  explicit ThreeDMBitmapVerifier(const ThreeDMInstance& instance);
+
+  /**
+   * @return Index in M of each triple, or std::nullopt if one is not in M.
+   */
+  auto ToIndices(const std::vector<Triple>& matching) const
+      -> std::optional<std::vector<uint32_t>>;
+
+  /**
+   * @return true if the triples of M at the given indices are a perfect
+   * matching.
+   */
+  auto Verify(const std::vector<uint32_t>& matching) const -> bool;
+
+  auto Verify(const std::vector<Triple>& matching) const -> bool;
+
+  /**
+   * @brief Verifies every candidate, split over threads.
+   * @param threads Number of threads; 0 means
+   * std::thread::hardware_concurrency.
+   * @return 1 for each valid candidate, 0 otherwise, in input order.
+   */
+  auto VerifyBatch(const std::vector<std::vector<uint32_t>>& candidates,
+                   size_t threads = 0) const -> std::vector<uint8_t>;
+
+  /**
+   * @brief As above for matchings of triples; the conversion runs on the
+   * threads too.
+   */
+  auto VerifyBatch(const std::vector<std::vector<Triple>>& candidates,
+                   size_t threads = 0) const -> std::vector<uint8_t>;
+
+ private:
+  size_t q_;
+  TripleConflictIndex index_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_BITMAP_VERIFIER_H_
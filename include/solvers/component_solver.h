@@ -0,0 +1,66 @@
+#ifndef PARTITION_INCLUDE_COMPONENT_SOLVER_H_
+#define PARTITION_INCLUDE_COMPONENT_SOLVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ComponentSolver class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+#include "core/triple.h"
+#include "interfaces/instance_solver.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Finds a perfect 3DM matching one connected component at a time.
+ *
+ * The instance is split by ComponentDecomposer and each component is
+ * reduced on its own (ReduceCompact, so its q and p only depend on the
+ * component) and solved with WidthDispatchSolver: at the narrowest
+ * weight width when the sizes fit in 128 bits, by ReducedPartitionSolver
+ * otherwise. Components run on several threads, largest first. Components that cannot have a perfect
+ * matching (unequal W, X and Y, or fewer than q triples) fail the whole
+ * instance before any search starts, and the first unsolvable component
+ * stops the remaining ones from starting.
+ */
+class ComponentSolver
+    : public InstanceSolver<ThreeDMInstance, std::vector<Triple>> {
+ public:
+  /**
+   * @param threads Solver threads; 0 means std::thread::hardware_concurrency.
+   */
+  explicit ComponentSolver(size_t threads = 0);
+
+  /**
+   * @return The union of the component matchings, component by component,
+   * or std::nullopt if some component has no perfect matching.
+   */
+  auto Solve(const ThreeDMInstance& instance)
+      -> std::optional<std::vector<Triple>> override;
+
+  auto GetAlgorithmName() const -> std::string override;
+
+  /**
+   * @brief Number of components of the last instance solved.
+   */
+  auto last_component_count() const -> size_t { return last_components_; }
+
+ private:
+  size_t threads_;
+  size_t last_components_ = 0;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_COMPONENT_SOLVER_H_
@@ -0,0 +1,77 @@
+#ifndef PARTITION_INCLUDE_INSTANCE_FEATURES_H_
+#define PARTITION_INCLUDE_INSTANCE_FEATURES_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the instance feature extractors.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "core/reduced_partition_instance.h"
+#include "core/three_d_m_instance.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace partition {
+
+/**
+ * @brief What the solver cost model knows about a Partition instance.
+ * Sums that do not fit in 64 bits saturate at UINT64_MAX.
+ */
+struct PartitionFeatures {
+  size_t n = 0;               ///< Elements.
+  uint64_t max_size = 0;      ///< Largest size.
+  uint64_t total_sum = 0;     ///< Sum of the sizes.
+  size_t distinct_sizes = 0;  ///< Different size values.
+  size_t bit_width = 0;       ///< Bits of the largest size.
+  /// Shaped like a ThreeDMToPartitionReducer output: every size but the
+  /// last two (the fillers) has exactly three bits set.
+  bool reduced = false;
+};
+
+/**
+ * @brief What the solver cost model knows about a 3DM instance. The degree
+ * of an element is the number of triples containing it.
+ */
+struct ThreeDMFeatures {
+  size_t q = 0;            ///< Elements per set.
+  size_t k = 0;            ///< Triples.
+  size_t min_degree = 0;   ///< Over the 3q elements.
+  size_t max_degree = 0;   ///< Over the 3q elements.
+  double mean_degree = 0;  ///< k / q for a valid instance.
+};
+
+auto ExtractFeatures(std::span<const uint64_t> sizes) -> PartitionFeatures;
+auto ExtractFeatures(const PartitionInstance& instance) -> PartitionFeatures;
+
+/**
+ * @brief Features of a compact reduction, computed from its positions
+ * without expanding the sizes. Always reduced.
+ */
+auto ExtractFeatures(const ReducedPartitionInstance& instance)
+    -> PartitionFeatures;
+
+/**
+ * @throws std::out_of_range if a triple names an element outside W, X or
+ * Y.
+ */
+auto ExtractFeatures(const ThreeDMInstance& instance) -> ThreeDMFeatures;
+
+/**
+ * @brief Features the ThreeDMToPartitionReducer output of an instance with
+ * these features will have, so an engine can be picked before reducing.
+ * The distinct size count is an upper bound (repeated triples coincide).
+ */
+auto ReductionFeatures(const ThreeDMFeatures& features) -> PartitionFeatures;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_INSTANCE_FEATURES_H_
@@ -0,0 +1,103 @@
+#ifndef PARTITION_INCLUDE_LOCAL_SEARCH_SOLVER_H_
+#define PARTITION_INCLUDE_LOCAL_SEARCH_SOLVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the LocalSearchSolver class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "solvers/partition_solver.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace partition {
+
+struct LocalSearchOptions {
+  size_t threads = 0;            ///< Workers; 0 uses every core.
+  double time_budget_ms = 100;   ///< Wall-clock budget of one call.
+  uint64_t seed = 1;             ///< Worker w draws from seed + w.
+  size_t share_interval = 64;    ///< Descents between looks at the best.
+  size_t tabu_tenure = 16;       ///< Moves an element stays put after a kick.
+};
+
+/**
+ * @brief A new best split found by the ensemble.
+ */
+struct LocalSearchImprovement {
+  double elapsed_ms;    ///< Since the call started.
+  uint64_t difference;  ///< Difference of the new best split.
+  size_t worker;        ///< Worker that found it.
+};
+
+/**
+ * @brief Anytime minimum-difference heuristic for Partition instances too
+ * large for the exact solvers.
+ *
+ * Every worker starts from the Karmarkar-Karp differencing split and
+ * alternates two phases until the budget runs out or a split with
+ * difference total % 2 is found:
+ * - Descent: applies the best of several move kinds while one shrinks
+ *   the difference. Moves are a single element to the lighter side, a
+ *   swap, and 2-for-1 or 1-for-2 exchanges. With both sides kept sorted
+ *   by size, the best partner for an element is a binary search away, so
+ *   a step costs O(n log n); 2-for-1 pairs are sampled.
+ * - Kick: a few random swaps. The elements involved become tabu for the
+ *   next tabu_tenure moves, so the descent cannot simply undo them.
+ * A worker whose kicks stop paying off restarts, alternately from its
+ * best split and from a randomized Karmarkar-Karp one.
+ *
+ * Workers are seeded independently. Every share_interval descents each
+ * one publishes its best split and, if another worker holds a better
+ * one, continues from that instead.
+ */
+class LocalSearchSolver {
+ public:
+  using ProgressCallback = std::function<void(const LocalSearchImprovement&)>;
+
+  explicit LocalSearchSolver(LocalSearchOptions options = {});
+
+  /**
+   * @return The best split found within the budget; optimal is set only
+   * when its difference is total % 2.
+   */
+  auto SolveMinimumDifference(const PartitionInstance& instance)
+      -> PartitionSplit;
+
+  auto GetAlgorithmName() const -> std::string;
+
+  /**
+   * @brief Called, under a lock, each time the shared best improves.
+   */
+  auto SetProgressCallback(ProgressCallback callback) -> void {
+    progress_ = std::move(callback);
+  }
+
+  /**
+   * @return Improvements of the shared best during the last call, in time
+   * order, starting with the Karmarkar-Karp split.
+   */
+  auto trace() const -> const std::vector<LocalSearchImprovement>& {
+    return trace_;
+  }
+
+ private:
+  LocalSearchOptions options_;
+  ProgressCallback progress_;
+  std::vector<LocalSearchImprovement> trace_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_LOCAL_SEARCH_SOLVER_H_
@@ -0,0 +1,76 @@
+#ifndef PARTITION_INCLUDE_MATCHING_COUNTER_H_
+#define PARTITION_INCLUDE_MATCHING_COUNTER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the MatchingCounter class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance.h"
+#include "core/triple.h"
+#include "core/wide_unsigned.h"
+#include "util/generator.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Counts and lists every perfect matching of a 3DM instance.
+ *
+ * A perfect matching is an exact cover of the 3q elements by triples, so
+ * both run Knuth's dancing links (DLX) over one column per element and
+ * one row per triple, always branching on the column with the fewest
+ * rows left. Repeated triples are distinct rows and give distinct
+ * matchings.
+ */
+class MatchingCounter {
+ public:
+  /// Memoized subproblems per component; each keeps a 3q-bit key.
+  static constexpr size_t kDefaultMaxMemoEntries = size_t{1} << 20;
+
+  /**
+   * @param max_memo_entries Subproblems Count remembers per component;
+   * 0 disables the memo.
+   */
+  explicit MatchingCounter(size_t max_memo_entries = kDefaultMaxMemoEntries);
+
+  /**
+   * @brief Number of perfect matchings.
+   *
+   * The instance is split by ComponentDecomposer and the count is the
+   * product of the component counts. Within a component the number of
+   * covers of the still uncovered columns only depends on which columns
+   * those are, so DLX memoizes it by that set and counts shared
+   * subproblems once instead of visiting every matching.
+   * @throws std::out_of_range if a triple names an element outside W, X
+   * or Y.
+   */
+  auto Count(const ThreeDMInstance& instance) const -> WideUnsigned;
+
+  /**
+   * @brief Every perfect matching, one at a time, with its triples in
+   * search order.
+   *
+   * DLX runs iteratively inside the coroutine, so a step needs nothing
+   * beyond the links and the current search path. instance must outlive
+   * the generator.
+   * @throws std::out_of_range as Count, when the generator starts.
+   */
+  auto Enumerate(const ThreeDMInstance& instance) const
+      -> Generator<std::vector<Triple>>;
+
+ private:
+  size_t max_memo_entries_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_MATCHING_COUNTER_H_
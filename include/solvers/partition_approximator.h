@@ -0,0 +1,66 @@
+#ifndef PARTITION_INCLUDE_PARTITION_APPROXIMATOR_H_
+#define PARTITION_INCLUDE_PARTITION_APPROXIMATOR_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionApproximator class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "solvers/partition_solver.h"
+
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Fully polynomial approximation scheme for the minimum-difference
+ * split.
+ *
+ * The heavier side of the returned split is at most (1 + epsilon) times
+ * the heavier side of an optimal one. With T = total / 2, sizes above T
+ * never go in the lighter side, sizes up to epsilon * T / 2 are small and
+ * the rest, fewer than 4 / epsilon, are large. The large sizes run through
+ * the subset-sum list algorithm with trimming: after each size the sorted
+ * list of sums up to T is cut into intervals of width
+ * delta = epsilon * T / (2 * large) and only the first sum of each
+ * interval is kept, so the list never holds more than 2 * large / epsilon
+ * + 1 sums and the largest one loses at most epsilon * T / 2. The small
+ * sizes are then added to it first-fit, losing at most another
+ * epsilon * T / 2. Time and memory are O(n log n + 1 / epsilon^3),
+ * whatever the magnitude of the sizes, so it runs where the bitset
+ * dynamic programming cannot.
+ */
+class PartitionApproximator {
+ public:
+  static constexpr double kDefaultEpsilon = 0.01;
+
+  /**
+   * @throws std::invalid_argument unless 0 < epsilon < 1.
+   */
+  explicit PartitionApproximator(double epsilon = kDefaultEpsilon);
+
+  /**
+   * @return The approximate split; optimal is set only when its
+   * difference is total % 2.
+   */
+  auto SolveMinimumDifference(const PartitionInstance& instance) const
+      -> PartitionSplit;
+
+  auto GetAlgorithmName() const -> std::string;
+
+  auto epsilon() const -> double { return epsilon_; }
+
+ private:
+  double epsilon_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARTITION_APPROXIMATOR_H_
@@ -0,0 +1,89 @@
+#ifndef PARTITION_INCLUDE_PARTITION_COUNTER_H_
+#define PARTITION_INCLUDE_PARTITION_COUNTER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionCounter class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+#include "core/wide_unsigned.h"
+#include "util/generator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Counts and lists every perfect split of a Partition instance.
+ *
+ * A split is unordered and elements are told apart by id, so equal sizes
+ * give distinct splits. Each split is identified by its side holding the
+ * first element, which is what Enumerate yields.
+ */
+class PartitionCounter {
+ public:
+  /// Largest table Count or Enumerate allocates by default (1 GiB).
+  static constexpr size_t kDefaultMaxTableBytes = size_t{1} << 30;
+
+  /**
+   * @param max_table_bytes Largest table Count or Enumerate may allocate;
+   * instances needing more throw std::length_error.
+   */
+  explicit PartitionCounter(size_t max_table_bytes = kDefaultMaxTableBytes);
+
+  /**
+   * @brief Number of perfect splits, by a counting subset-sum DP.
+   *
+   * Cell s holds how many subsets of the elements seen so far add up to
+   * s, as a multi-limb integer. Cells start one limb wide and all grow by
+   * one limb when a count could overflow, so time is
+   * O(n * S * width) for half total S and the table takes up to
+   * 8 * S * (2 * width - 1) bytes while it widens, width being at most
+   * n / 64 + 1. The PartitionFilter answers zero without a table when it
+   * can.
+   * @throws std::length_error if CountMemory exceeds the table limit.
+   */
+  auto Count(const PartitionInstance& instance) const -> WideUnsigned;
+
+  /**
+   * @brief Every perfect split, one at a time.
+   *
+   * One reachability bitset per element prefix is built up front, an
+   * O(n * S / 64)-word table for half total S. After that a depth-first
+   * search only takes branches that still lead to a split, so each step
+   * costs O(n) time and allocates nothing beyond the search path.
+   * instance must outlive the generator.
+   * @throws std::length_error if EnumerateMemory exceeds the table limit,
+   * when the generator starts.
+   */
+  auto Enumerate(const PartitionInstance& instance) const
+      -> Generator<std::set<std::string>>;
+
+  /**
+   * @brief Peak bytes of the Count table, at its widest; saturates at
+   * UINT64_MAX.
+   */
+  static auto CountMemory(const PartitionInstance& instance) -> uint64_t;
+
+  /**
+   * @brief Bytes of the Enumerate prefix table; saturates at UINT64_MAX.
+   */
+  static auto EnumerateMemory(const PartitionInstance& instance) -> uint64_t;
+
+ private:
+  size_t max_table_bytes_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARTITION_COUNTER_H_
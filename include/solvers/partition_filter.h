@@ -0,0 +1,79 @@
+#ifndef PARTITION_INCLUDE_PARTITION_FILTER_H_
+#define PARTITION_INCLUDE_PARTITION_FILTER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the PartitionFilter class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Why a Partition instance has no equal split.
+ */
+struct PartitionRejection {
+  enum class Reason {
+    kOddTotal,         ///< The total is odd.
+    kElementTooLarge,  ///< One size exceeds half the total.
+    kCommonDivisor,    ///< The gcd of the sizes does not divide the half.
+    kResidue           ///< No subset reaches the half modulo some prime.
+  };
+
+  Reason reason;
+  std::string explanation;
+
+  static auto ReasonName(Reason reason) -> const char*;
+};
+
+/**
+ * @brief Cheap proofs that a Partition instance is unsolvable.
+ *
+ * Checks parity, the largest size, the gcd of the sizes and, for each of
+ * a few small primes m, whether half the total is a subset sum modulo m
+ * (an m-bit cyclic bitset DP, O(n * m / 64) words). Any failure proves
+ * there is no equal split; passing proves nothing. The primes run in
+ * parallel on large instances, and each stops early once every residue is
+ * reachable, which is what happens on most random sizes.
+ */
+class PartitionFilter {
+ public:
+  /// Largest modulus the residue DP supports.
+  static constexpr size_t kMaxModulus = 1024;
+  static constexpr std::array<uint32_t, 5> kDefaultModuli = {61, 127, 251,
+                                                             509, 1021};
+
+  /**
+   * @param threads Threads for the residue DPs; 0 means
+   * std::thread::hardware_concurrency. Small instances always run on the
+   * caller.
+   */
+  explicit PartitionFilter(size_t threads = 0);
+
+  /**
+   * @return Why the instance is unsolvable, or std::nullopt if no check
+   * could tell.
+   */
+  auto Check(const PartitionInstance& instance) const
+      -> std::optional<PartitionRejection>;
+
+ private:
+  size_t threads_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARTITION_FILTER_H_
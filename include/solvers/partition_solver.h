@@ -12,14 +12,39 @@
  * @date 11-12-2025
  */
 
-#include "instance_solver.h"
-#include "partition_instance.h"
+#include "core/partition_instance.h"
+#include "interfaces/instance_solver.h"
+#include "solvers/partition_filter.h"
+#include "solvers/transposition_table.h"
 
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace partition {
 
+class SolverCostModel;
+
+/**
+ * @brief A split of a Partition instance into a subset and the rest, for
+ * when the sides need not be equal.
+ */
+struct PartitionSplit {
+  /// Ids of the lighter side; the heavier side is every other element.
+  std::set<std::string> subset;
+  /// Sum of subset, at most half the total.
+  uint64_t subset_sum = 0;
+  /// total - 2 * subset_sum.
+  uint64_t difference = 0;
+  /// true if no split has a smaller difference.
+  bool optimal = false;
+};
+
 /**
  * @brief Solves Partition problem instances.
  */
@@ -28,41 +53,276 @@ class PartitionSolver
  public:
   enum class Algorithm {
     kDynamicProgramming,
+    kMultisetDynamicProgramming,
+    kSumsetConvolution,
     kBacktracking,
-    kGreedyHeuristic
+    kGreedyHeuristic,
+    /// Picks an engine per instance with a SolverCostModel.
+    kAuto
   };
 
-  explicit PartitionSolver(Algorithm algo = Algorithm::kDynamicProgramming);
+  /// Largest half-sum the dynamic programming bitset is allowed to cover.
+  static constexpr uint64_t kMaxDynamicProgrammingTarget = uint64_t{1} << 32;
+
+  /// Default wall-clock budget of the kAuto local-search fallback.
+  static constexpr double kDefaultLocalSearchBudgetMs = 1000;
+
+  /// Default capacity of the backtracking transposition table (4 MiB).
+  static constexpr size_t kDefaultTranspositionEntries = size_t{1} << 18;
+
+  /**
+   * @param algo Algorithm used by Solve.
+   * @param resource Memory resource for the dynamic programming bitsets,
+   * e.g. a CountingMemoryResource to measure them.
+   */
+  explicit PartitionSolver(
+      Algorithm algo = Algorithm::kDynamicProgramming,
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
   auto Solve(const PartitionInstance& instance)
       -> std::optional<std::set<std::string>> override;
 
+  /**
+   * @return The algorithm name; for kAuto, with the engine of the last
+   * call in parentheses.
+   */
   auto GetAlgorithmName() const -> std::string override;
 
+  static auto AlgorithmName(Algorithm algorithm) -> std::string;
+
+  /**
+   * @brief Split with the smallest difference between the sides, perfect
+   * or not. The dynamic programming and sumset algorithms take the
+   * largest reachable sum up to half the total, backtracking runs a branch
+   * and bound over the size groups, and the greedy heuristic returns its
+   * own split, which is optimal only if its difference is total % 2. The
+   * filter is not consulted, since it only rules out perfect splits.
+   * kAuto runs SolverCostModel::Choose, which prices backtracking at its
+   * worst case since it has to rule out every better split. If even the
+   * chosen engine is predicted to outlast the local-search budget, kAuto
+   * runs LocalSearchSolver for that budget instead and the split is
+   * optimal only if its difference is total % 2.
+   * @throws std::length_error As Solve, for targets too large for dynamic
+   * programming or the sumset engine.
+   */
+  auto SolveMinimumDifference(const PartitionInstance& instance)
+      -> PartitionSplit;
+
+  /**
+   * @brief Approximate peak working memory of Solve on the instance, not
+   * counting the returned subset.
+   */
+  auto EstimateMemory(const PartitionInstance& instance) const -> size_t;
+
+  /**
+   * @brief Sets the capacity of the transposition table; 0 disables it.
+   * The table is allocated by the first backtracking search and reused.
+   */
+  auto SetTranspositionEntries(size_t entries) -> void;
+
+  /**
+   * @brief Enables or disables the PartitionFilter run before the search
+   * (on by default).
+   */
+  auto SetFilterEnabled(bool enabled) -> void { filter_enabled_ = enabled; }
+
+  /**
+   * @return Why the filter rejected the last instance given to Solve, or
+   * std::nullopt if it did not.
+   */
+  auto last_rejection() const -> const std::optional<PartitionRejection>& {
+    return last_rejection_;
+  }
+
+  /**
+   * @brief Threads for the dynamic programming bitset passes; 0 means
+   * std::thread::hardware_concurrency. 1 (the default) keeps them on the
+   * calling thread. Passes over bitsets too small to give each thread
+   * two blocks use fewer threads.
+   */
+  auto SetDynamicProgrammingThreads(size_t threads) -> void {
+    dp_threads_ = threads;
+  }
+
+  /**
+   * @brief Wall-clock budget of the kAuto minimum-difference fallback to
+   * LocalSearchSolver, which runs on as many threads as the dynamic
+   * programming passes; 0 keeps kAuto exact.
+   */
+  auto SetLocalSearchBudget(double milliseconds) -> void {
+    local_search_budget_ms_ = milliseconds;
+  }
+
+  /**
+   * @brief Model kAuto ranks the engines with; nullptr (the default) uses
+   * the built-in coefficients. May be shared between solvers.
+   */
+  auto SetCostModel(std::shared_ptr<const SolverCostModel> model) -> void {
+    cost_model_ = std::move(model);
+  }
+
+  /**
+   * @return Engine that answered the last Solve or SolveMinimumDifference
+   * call; with kAuto, the one the plan ended on.
+   */
+  auto last_algorithm() const -> Algorithm { return last_algorithm_; }
+
  private:
-  auto SolveDynamicProgramming(const PartitionInstance& instance)
+  auto SolveDynamicProgramming(const PartitionInstance& instance,
+                               bool multiset)
+      -> std::optional<std::set<std::string>>;
+  auto SolveWith(Algorithm algorithm, const PartitionInstance& instance)
+      -> std::optional<std::set<std::string>>;
+  /**
+   * @brief Runs the cost model's plan: greedy, if planned, ends the run
+   * only with a perfect split; the first exact engine that can take the
+   * instance decides, and the next one is only tried after a
+   * std::length_error. Backtracking followed by another engine stops
+   * after SolverCostModel::BacktrackingBudget nodes.
+   */
+  auto SolveAuto(const PartitionInstance& instance)
+      -> std::optional<std::set<std::string>>;
+  /**
+   * @return algorithm_, or for kAuto SolverCostModel::Choose.
+   */
+  auto Resolve(const PartitionInstance& instance) const -> Algorithm;
+  /**
+   * @return true if kAuto should hand a minimum-difference call to
+   * LocalSearchSolver: its worst-case exact engine outlasts the budget.
+   */
+  auto PreferLocalSearch(const PartitionInstance& instance) const -> bool;
+  auto SolveSumset(const PartitionInstance& instance)
       -> std::optional<std::set<std::string>>;
-  auto SolveBacktracking(const PartitionInstance& instance)
+  /**
+   * @param node_budget Nodes after which the search gives up; 0 means no
+   * limit.
+   * @throws std::length_error if the budget runs out before a split is
+   * found.
+   */
+  auto SolveBacktracking(const PartitionInstance& instance,
+                         uint64_t node_budget = 0)
       -> std::optional<std::set<std::string>>;
   auto SolveGreedy(const PartitionInstance& instance)
       -> std::optional<std::set<std::string>>;
+  auto GreedySplit(const PartitionInstance& instance) const
+      -> std::vector<size_t>;
+  auto MinimumDifferenceDynamicProgramming(const PartitionInstance& instance,
+                                           bool multiset)
+      -> std::vector<size_t>;
+  auto MinimumDifferenceSumset(const PartitionInstance& instance)
+      -> std::vector<size_t>;
+  auto MinimumDifferenceBacktracking(const PartitionInstance& instance)
+      -> std::vector<size_t>;
+
+  /**
+   * @brief Fills order_, groups_, suffix_sums_ and taken_ for a search
+   * over the elements from position first of the decreasing order, and
+   * resets the transposition table.
+   */
+  auto PrepareBacktracking(const PartitionInstance& instance, size_t first)
+      -> void;
+  /**
+   * @brief Element indices the search state takes: order_[0] if
+   * with_first, then taken[g] elements of each group.
+   */
+  auto BacktrackIndices(const std::vector<size_t>& taken, bool with_first) const
+      -> std::vector<size_t>;
 
   /**
    * @brief Helper for backtracking.
-   * @param instance The partition instance.
-   * @param index Current element index.
+   *
+   * Decides how many elements of groups_[group] go to the subset, most
+   * first. Failed (group, current_sum) states are recorded in the
+   * transposition table, since many choices reach the same sum.
+   * @param group Current size group.
    * @param current_sum Current subset sum.
    * @param target_sum Target sum to achieve.
-   * @param current_subset Current subset being built.
    * @return true if solution found, false otherwise.
    */
-  auto BacktrackHelper(const PartitionInstance& instance, size_t index,
-                       int64_t current_sum, int64_t target_sum,
-                       std::set<std::string>& current_subset) -> bool;
+  auto BacktrackHelper(size_t group, int64_t current_sum, int64_t target_sum)
+      -> bool;
+
+  /**
+   * @brief Branch and bound for the largest subset sum up to target_sum,
+   * kept in best_sum_ and best_taken_. A branch stops when it cannot beat
+   * best_sum_, and takes every remaining element when they all fit.
+   * Visited states go to the transposition table: a state is explored in
+   * full the first time, so a second visit cannot improve the best.
+   */
+  auto MinimizeHelper(size_t group, int64_t current_sum, int64_t target_sum)
+      -> void;
+
+  /**
+   * @brief Run of equal sizes in order_, explored as one counted choice.
+   */
+  struct SizeGroup {
+    int64_t size;
+    size_t first;  ///< Position of the first member in order_.
+    size_t count;
+  };
 
   Algorithm algorithm_;
+  std::pmr::memory_resource* resource_;
+  // Backtracking state: element indices by decreasing size, the groups of
+  // equal sizes after the first element, the sum of the sizes from each
+  // group to the end and how many of each group the subset takes.
+  std::vector<size_t> order_;
+  std::vector<SizeGroup> groups_;
+  std::vector<int64_t> suffix_sums_;
+  std::vector<size_t> taken_;
+  size_t transposition_entries_ = kDefaultTranspositionEntries;
+  std::unique_ptr<TranspositionTable> table_;
+  uint64_t nodes_explored_ = 0;
+  uint64_t node_budget_ = 0;  ///< 0 for none.
+  int64_t best_sum_ = 0;
+  std::vector<size_t> best_taken_;
+  PartitionFilter filter_{1};
+  bool filter_enabled_ = true;
+  std::optional<PartitionRejection> last_rejection_;
+  std::shared_ptr<const SolverCostModel> cost_model_;
+  Algorithm last_algorithm_;
+  bool last_local_search_ = false;
+  size_t dp_threads_ = 1;
+  double local_search_budget_ms_ = kDefaultLocalSearchBudgetMs;
 };
 
+/**
+ * @brief Indices of sizes adding up to target, found with the bitset
+ * dynamic programming of PartitionSolver. Memory is O(target) bits.
+ * @param resource Memory resource for the bitsets.
+ * @param threads Threads per bitset pass, as
+ * PartitionSolver::SetDynamicProgrammingThreads. A parallel pass slices
+ * the bitset into blocks and holds a second copy of it.
+ */
+auto FindSubsetWithSum(
+    const std::vector<uint64_t>& sizes, uint64_t target,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+    size_t threads = 1) -> std::optional<std::vector<size_t>>;
+
+/**
+ * @brief FindSubsetWithSum for sizes with many repeats.
+ *
+ * Equal sizes are grouped and each group of c copies is split into
+ * bundles of 1, 2, 4, ... copies (binary splitting), so any count up to c
+ * is a sum of bundles. The bitset pass then runs over O(sum of log c)
+ * bundles instead of n elements, and the chosen bundles are turned back
+ * into that many indices of the group.
+ */
+auto FindMultisetWithSum(
+    const std::vector<uint64_t>& sizes, uint64_t target,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+    size_t threads = 1) -> std::optional<std::vector<size_t>>;
+
+/**
+ * @brief PartitionSplit with the elements at indices on one side, which
+ * may be either the lighter or the heavier one.
+ * @param exact true if the split is known to be optimal; otherwise it is
+ * marked optimal only when its difference is total % 2.
+ */
+auto MakePartitionSplit(const PartitionInstance& instance,
+                        const std::vector<size_t>& indices, bool exact)
+    -> PartitionSplit;
+
 }  // namespace partition
 
 #endif  // PARTITION_INCLUDE_PARTITION_SOLVER_H_
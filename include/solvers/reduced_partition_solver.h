@@ -0,0 +1,61 @@
+#ifndef PARTITION_INCLUDE_REDUCED_PARTITION_SOLVER_H_
+#define PARTITION_INCLUDE_REDUCED_PARTITION_SOLVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ReducedPartitionSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/reduced_partition_instance.h"
+#include "interfaces/instance_solver.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Structure-aware solver working on the compact reduced form.
+ *
+ * A subset containing b1 sums to half the total exactly when its a_i cover
+ * every p-bit field once, so the search is an exact cover over the 3q
+ * fields: branch on the uncovered field with the fewest usable elements.
+ * Sizes are never expanded.
+ */
+class ReducedPartitionSolver
+    : public InstanceSolver<ReducedPartitionInstance, std::set<std::string>> {
+ public:
+  auto Solve(const ReducedPartitionInstance& instance)
+      -> std::optional<std::set<std::string>> override;
+
+  auto GetAlgorithmName() const -> std::string override;
+
+ private:
+  /**
+   * @brief Recursive exact cover search.
+   * @param covered Coverage flag per field slot.
+   * @param remaining Number of uncovered slots.
+   * @param chosen Indices of the chosen triple elements.
+   * @return true if every slot got covered.
+   */
+  auto Search(std::vector<bool>& covered, size_t remaining,
+              std::vector<size_t>& chosen) -> bool;
+
+  auto IsUsable(size_t element, const std::vector<bool>& covered) const
+      -> bool;
+
+  const ReducedPartitionInstance* instance_ = nullptr;
+  std::vector<std::vector<size_t>> elements_by_slot_;
+  uint64_t nodes_explored_ = 0;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_REDUCED_PARTITION_SOLVER_H_
@@ -12,10 +12,13 @@
  * @date 11-12-2025
  */
 
-#include "partition_instance.h"
-#include "three_d_m_instance.h"
-#include "triple.h"
+#include "core/partition_instance.h"
+#include "core/reduced_partition_instance.h"
+#include "core/three_d_m_instance.h"
+#include "core/triple.h"
+#include "solvers/bitmap_verifier.h"
 
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -24,6 +27,11 @@ namespace partition {
 
 /**
  * @brief Verifies solutions for problem instances.
+ *
+ * The checks run on dense indices (see PartitionBitmapVerifier and
+ * ThreeDMBitmapVerifier); ids and element names are only looked up once
+ * to build them. Callers checking many solutions of one instance should
+ * keep a bitmap verifier or use the batch functions.
  */
 class SolutionVerifier {
  public:
@@ -48,6 +56,41 @@ class SolutionVerifier {
                                       const std::set<std::string>& subset)
       -> bool;
 
+  /**
+   * @brief Verifies many 3DM matchings of one instance in parallel.
+   * @param threads Number of threads; 0 means
+   * std::thread::hardware_concurrency.
+   * @return 1 for each valid matching, 0 otherwise, in input order.
+   */
+  static auto Verify3DMSolutions(
+      const ThreeDMInstance& instance,
+      const std::vector<std::vector<Triple>>& matchings, size_t threads = 0)
+      -> std::vector<uint8_t>;
+
+  /**
+   * @brief Verifies many Partition subsets of one instance in parallel.
+   * @param threads Number of threads; 0 means
+   * std::thread::hardware_concurrency.
+   * @return 1 for each valid subset, 0 otherwise, in input order.
+   */
+  static auto VerifyPartitionSolutions(
+      const PartitionInstance& instance,
+      const std::vector<std::set<std::string>>& subsets, size_t threads = 0)
+      -> std::vector<uint8_t>;
+
+  /**
+   * @brief Verifies a Partition solution on the compact reduced form.
+   *
+   * The subset sum is assembled field by field from the bit positions, so
+   * no element size is ever expanded.
+   * @param instance The compact reduced instance.
+   * @param subset The proposed subset A'.
+   * @return true if the partition is valid, false otherwise.
+   */
+  static auto VerifyPartitionSolution(const ReducedPartitionInstance& instance,
+                                      const std::set<std::string>& subset)
+      -> bool;
+
   /**
    * @brief Gets a detailed verification report for a 3DM solution.
    *
@@ -0,0 +1,147 @@
+#ifndef PARTITION_INCLUDE_SOLVER_COST_MODEL_H_
+#define PARTITION_INCLUDE_SOLVER_COST_MODEL_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the SolverCostModel class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/instance_features.h"
+#include "solvers/partition_solver.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Measured running time of one engine on one instance.
+ */
+struct CostSample {
+  PartitionSolver::Algorithm algorithm;
+  PartitionFeatures features;
+  double milliseconds = 0;
+};
+
+/**
+ * @brief Predicts the running time of each PartitionSolver engine from
+ * instance features, for Algorithm::kAuto.
+ *
+ * Each engine has a work formula in its own unit and one coefficient,
+ * milliseconds per unit:
+ * - Dynamic programming: n * (S / 64 + 1) bitset words, S half the total
+ * - Multiset: the same with the size bundles in place of n
+ * - Sumset: S * log2(S) * log2(n) butterflies
+ * - Backtracking: n * log2(n) nodes when 2^n dwarfs n * S and splits are
+ *   plentiful, else n * 2^(n / 2) (the Partition phase transition). The
+ *   first figure only holds when a split exists, so Plan gives
+ *   backtracking a node budget when another engine follows it, and Choose
+ *   prices it at the second.
+ * - Greedy: n * log2(n)
+ * An engine that cannot take the instance (a table over its limit) has no
+ * estimate. The coefficients default to measurements of the bench target
+ * and can be recalibrated with `bench -c <file>` and loaded back.
+ */
+class SolverCostModel {
+ public:
+  using Algorithm = PartitionSolver::Algorithm;
+
+  /// Engines with a coefficient: every Algorithm but kAuto.
+  static constexpr size_t kEngineCount = 5;
+
+  /// Greedy goes first when it costs under this share of the best exact
+  /// engine, since it ends the search whenever its split is perfect.
+  static constexpr double kGreedyShare = 0.05;
+
+  /// Fewest nodes a budgeted backtracking search gets.
+  static constexpr uint64_t kMinBacktrackingBudget = uint64_t{1} << 16;
+
+  /**
+   * @brief Model with the built-in coefficients.
+   */
+  SolverCostModel();
+
+  /**
+   * @brief Reads "<engine> <ms per unit>" lines (engines named as on the
+   * command line: dp, multiset, sumset, backtracking, greedy). Lines
+   * starting with # are comments; engines not listed keep the built-in
+   * coefficient.
+   * @throws std::runtime_error if the file cannot be read or a line is
+   * malformed.
+   */
+  static auto LoadFromFile(const std::string& filename) -> SolverCostModel;
+
+  /**
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  auto WriteToFile(const std::string& filename) const -> void;
+
+  /**
+   * @param worst_case Price backtracking as if the instance had no split,
+   * or as a search for the best split, which must rule out the others.
+   * @return Work units of the engine on the instance, or std::nullopt if
+   * it cannot take it.
+   */
+  static auto Work(Algorithm algorithm, const PartitionFeatures& features,
+                   bool worst_case = false) -> std::optional<double>;
+
+  /**
+   * @return Predicted milliseconds, or std::nullopt as Work.
+   */
+  auto Estimate(Algorithm algorithm, const PartitionFeatures& features,
+                bool worst_case = false) const -> std::optional<double>;
+
+  /**
+   * @brief Engines to try, in order: the exact ones that can take the
+   * instance from cheapest to dearest, preceded by greedy when it is cheap
+   * enough and the instance is not a reduction (whose splits greedy
+   * essentially never finds). Backtracking is always among them; the
+   * caller should stop it after BacktrackingBudget nodes when an engine
+   * follows it, since its estimate assumes a split exists.
+   */
+  auto Plan(const PartitionFeatures& features) const -> std::vector<Algorithm>;
+
+  /**
+   * @brief Backtracking nodes worth the predicted time of next, the
+   * engine after it in the plan, and at least kMinBacktrackingBudget.
+   */
+  auto BacktrackingBudget(Algorithm next,
+                          const PartitionFeatures& features) const
+      -> uint64_t;
+
+  /**
+   * @brief Cheapest exact engine with backtracking priced at its worst
+   * case, for callers that run a single engine to the end: it must also
+   * answer "no" and minimum-difference searches in time.
+   */
+  auto Choose(const PartitionFeatures& features) const -> Algorithm;
+
+  /**
+   * @brief Sets each engine with samples to the median of its measured
+   * milliseconds per work unit.
+   */
+  auto Calibrate(const std::vector<CostSample>& samples) -> void;
+
+  auto coefficient(Algorithm algorithm) const -> double;
+
+  /**
+   * @brief Name used in model files and on the command line.
+   */
+  static auto EngineName(Algorithm algorithm) -> std::string;
+
+ private:
+  std::array<double, kEngineCount> ms_per_unit_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_SOLVER_COST_MODEL_H_
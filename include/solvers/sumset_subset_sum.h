@@ -0,0 +1,57 @@
+#ifndef PARTITION_INCLUDE_SUMSET_SUBSET_SUM_H_
+#define PARTITION_INCLUDE_SUMSET_SUBSET_SUM_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the sumset (convolution) subset sum engine.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace partition {
+
+/// Largest target of the sumset engine: its transforms hold 2^26 words.
+constexpr uint64_t kMaxSumsetTarget = uint64_t{1} << 25;
+
+/**
+ * @brief Bitset (64 sums per word) of the subset sums up to limit.
+ *
+ * The sizes are shuffled with seed, which colours them into random groups
+ * of near-equal total, and the groups are combined pairwise up a balanced
+ * tree. Each node keeps its sums up to min(limit, its total), so a level of
+ * the tree costs O(total) words however many elements it holds, and a
+ * Partition instance (total = 2 * target) takes O(t log t log n) instead of
+ * O(n t / 64). Small groups are leaves solved by the word-parallel DP. Two
+ * sets combine by shifting the sparser one into place when it has few
+ * sums, and otherwise by a number-theoretic transform (an FFT over integers
+ * modulo 15 * 2^27 + 1), which counts representations exactly, so the
+ * result is exact; the seed only changes the running time.
+ * @throws std::length_error if limit exceeds kMaxSumsetTarget.
+ */
+auto SubsetSumsConvolution(const std::vector<uint64_t>& sizes, uint64_t limit,
+                           uint64_t seed = 1) -> std::vector<uint64_t>;
+
+/**
+ * @brief Indices of sizes adding up to target, with the sumset engine.
+ *
+ * Each tree node rebuilds the sums of its two children and looks for a
+ * witness split a + (target - a) present in both, then recurses into them,
+ * so memory stays at a few bitsets per level.
+ * @throws std::length_error if target exceeds kMaxSumsetTarget.
+ */
+auto FindSubsetWithSumConvolution(const std::vector<uint64_t>& sizes,
+                                  uint64_t target, uint64_t seed = 1)
+    -> std::optional<std::vector<size_t>>;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_SUMSET_SUBSET_SUM_H_
@@ -0,0 +1,101 @@
+#ifndef PARTITION_INCLUDE_TRANSPOSITION_TABLE_H_
+#define PARTITION_INCLUDE_TRANSPOSITION_TABLE_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the TranspositionTable class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace partition {
+
+/**
+ * @brief Bounded, lock-free set of search states (index, sum) known to
+ * fail.
+ *
+ * Entries live in buckets of four that share a cache line; a state hashes
+ * to one bucket. When the bucket is full the entry with the least
+ * remaining depth (the cheapest subtree to search again) is replaced.
+ * Entries of earlier searches count as free, so NewSearch() empties the
+ * table without touching memory.
+ *
+ * Each entry is two relaxed atomic words, the metadata and the sum XORed
+ * with it, so a reader on another thread detects a half-written entry
+ * instead of taking a lock.
+ */
+class TranspositionTable {
+ public:
+  static constexpr size_t kBucketEntries = 4;
+
+  /**
+   * @param entries Capacity, rounded up to a power of two buckets.
+   */
+  explicit TranspositionTable(size_t entries);
+
+  TranspositionTable(const TranspositionTable&) = delete;
+  auto operator=(const TranspositionTable&) -> TranspositionTable& = delete;
+
+  /**
+   * @brief Forgets every entry. Not safe while other threads probe.
+   */
+  auto NewSearch() -> void;
+
+  /**
+   * @brief Returns true if (index, sum) was recorded in this search.
+   */
+  auto Contains(uint32_t index, uint64_t sum) const -> bool;
+
+  /**
+   * @brief Records that (index, sum) fails.
+   * @param depth Remaining depth below the state; deeper entries are kept
+   * longer.
+   */
+  auto Insert(uint32_t index, uint64_t sum, uint32_t depth) -> void;
+
+  auto capacity() const -> size_t { return bucket_count_ * kBucketEntries; }
+  auto bytes() const -> size_t { return bucket_count_ * sizeof(Bucket); }
+
+  /**
+   * @brief bytes() of a table built with the given capacity.
+   */
+  static auto BytesFor(size_t entries) -> size_t;
+
+  auto hits() const -> uint64_t {
+    return hits_.load(std::memory_order_relaxed);
+  }
+  auto replacements() const -> uint64_t {
+    return replacements_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Entry {
+    std::atomic<uint64_t> meta{0};   ///< index | generation | depth.
+    std::atomic<uint64_t> check{0};  ///< sum ^ meta.
+  };
+  struct alignas(64) Bucket {
+    std::array<Entry, kBucketEntries> entries;
+  };
+
+  auto BucketOf(uint32_t index, uint64_t sum) const -> Bucket&;
+
+  std::unique_ptr<Bucket[]> buckets_;
+  size_t bucket_count_;
+  uint16_t generation_ = 1;
+  mutable std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> replacements_{0};
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_TRANSPOSITION_TABLE_H_
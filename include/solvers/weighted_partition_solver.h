@@ -0,0 +1,100 @@
+#ifndef PARTITION_INCLUDE_WEIGHTED_PARTITION_SOLVER_H_
+#define PARTITION_INCLUDE_WEIGHTED_PARTITION_SOLVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the WeightedPartitionSolver class template.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/weighted_partition.h"
+#include "solvers/partition_solver.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief PartitionSolver's algorithms over sizes of a fixed width.
+ *
+ * Not an InstanceSolver: the width is chosen once per instance by
+ * WidthDispatchSolver, and everything below runs in Weight arithmetic
+ * without virtual calls or overflow checks. Instantiated for uint32_t,
+ * uint64_t and Uint128 in the implementation file.
+ */
+template <typename Weight>
+class WeightedPartitionSolver {
+ public:
+  using Algorithm = PartitionSolver::Algorithm;
+
+  explicit WeightedPartitionSolver(
+      Algorithm algo = Algorithm::kBacktracking);
+
+  /**
+   * @return Indices of the elements on one side, or std::nullopt if no
+   * equal split was found.
+   * @throws std::length_error for dynamic programming over a half-sum
+   * above PartitionSolver::kMaxDynamicProgrammingTarget, or when
+   * backtracking runs out of its node budget.
+   */
+  auto Solve(const WeightedPartition<Weight>& instance)
+      -> std::optional<std::vector<size_t>>;
+
+  /**
+   * @brief Nodes after which backtracking gives up with a
+   * std::length_error; 0 (the default) means no limit.
+   */
+  auto SetNodeBudget(uint64_t nodes) -> void { node_budget_ = nodes; }
+
+ private:
+  auto SolveDynamicProgramming(const WeightedPartition<Weight>& instance,
+                               Algorithm algorithm)
+      -> std::optional<std::vector<size_t>>;
+  auto SolveBacktracking(const WeightedPartition<Weight>& instance)
+      -> std::optional<std::vector<size_t>>;
+  auto SolveGreedy(const WeightedPartition<Weight>& instance)
+      -> std::optional<std::vector<size_t>>;
+
+  /**
+   * @brief Engine for kAuto: the cheapest exact one under the built-in
+   * SolverCostModel.
+   */
+  auto ChooseAlgorithm(const WeightedPartition<Weight>& instance) const
+      -> Algorithm;
+
+  /**
+   * @brief Sorts the element indices by decreasing size into order_ and
+   * their sizes into sorted_.
+   */
+  auto SortBySize(const WeightedPartition<Weight>& instance) -> void;
+
+  /**
+   * @brief Branches on sorted_[index]; current is the sum chosen so far.
+   */
+  auto Backtrack(size_t index, Weight current) -> bool;
+
+  Algorithm algorithm_;
+  // Backtracking state, kept as plain arrays of Weight.
+  std::vector<size_t> order_;
+  std::vector<Weight> sorted_;
+  std::vector<Weight> suffix_sums_;
+  std::vector<size_t> chosen_;
+  Weight target_ = 0;
+  uint64_t nodes_explored_ = 0;
+  uint64_t node_budget_ = 0;
+};
+
+extern template class WeightedPartitionSolver<uint32_t>;
+extern template class WeightedPartitionSolver<uint64_t>;
+extern template class WeightedPartitionSolver<Uint128>;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WEIGHTED_PARTITION_SOLVER_H_
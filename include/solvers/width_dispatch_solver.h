@@ -0,0 +1,78 @@
+#ifndef PARTITION_INCLUDE_WIDTH_DISPATCH_SOLVER_H_
+#define PARTITION_INCLUDE_WIDTH_DISPATCH_SOLVER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the WidthDispatchSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/reduced_partition_instance.h"
+#include "core/weight_width.h"
+#include "interfaces/instance_solver.h"
+#include "solvers/partition_solver.h"
+
+#include <set>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Solves reduced instances with the narrowest weight type that
+ * holds their total.
+ *
+ * The width is picked once per instance from its bit width: the sizes are
+ * expanded into uint32_t, uint64_t or Uint128 and solved by the matching
+ * WeightedPartitionSolver instantiation. Instances wider than 128 bits go
+ * to ReducedPartitionSolver, which never expands the sizes, and so do
+ * narrow ones the weighted search cannot settle within its node budget:
+ * plain backtracking is fast on reductions with a matching but blind to
+ * the field structure that lets the exact cover refute the others.
+ * Instances that leave an element uncovered are answered NO up front.
+ */
+class WidthDispatchSolver
+    : public InstanceSolver<ReducedPartitionInstance, std::set<std::string>> {
+ public:
+  using Algorithm = PartitionSolver::Algorithm;
+
+  /// Weighted backtracking nodes before falling back to the exact cover.
+  static constexpr uint64_t kDefaultNodeBudget = uint64_t{1} << 16;
+
+  /**
+   * @param node_budget Weighted backtracking nodes before the fallback;
+   * 0 means no limit.
+   */
+  explicit WidthDispatchSolver(Algorithm algo = Algorithm::kBacktracking,
+                               uint64_t node_budget = kDefaultNodeBudget);
+
+  auto Solve(const ReducedPartitionInstance& instance)
+      -> std::optional<std::set<std::string>> override;
+
+  auto GetAlgorithmName() const -> std::string override;
+
+  /**
+   * @brief Width used by the last call to Solve; kMultiLimb when
+   * ReducedPartitionSolver answered it.
+   */
+  auto last_width() const -> WeightWidth { return last_width_; }
+
+  /**
+   * @brief Width Solve would use for the instance.
+   */
+  static auto WidthFor(const ReducedPartitionInstance& instance)
+      -> WeightWidth;
+
+ private:
+  Algorithm algorithm_;
+  uint64_t node_budget_;
+  WeightWidth last_width_ = WeightWidth::k64;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WIDTH_DISPATCH_SOLVER_H_
@@ -0,0 +1,121 @@
+#ifndef PARTITION_INCLUDE_BENCHMARK_HARNESS_H_
+#define PARTITION_INCLUDE_BENCHMARK_HARNESS_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the BenchmarkHarness class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace partition {
+
+struct BenchmarkOptions {
+  size_t warmup = 3;        ///< Untimed runs before measuring.
+  size_t repetitions = 20;  ///< Timed runs.
+  std::string filter;       ///< Only run benchmarks whose name contains it.
+};
+
+/**
+ * @brief Timing statistics of one benchmark, in milliseconds.
+ */
+struct BenchmarkResult {
+  std::string name;
+  size_t repetitions = 0;
+  double min_ms = 0.0;
+  double mean_ms = 0.0;
+  double p50_ms = 0.0;
+  double p90_ms = 0.0;
+  double p99_ms = 0.0;
+  double max_ms = 0.0;
+  double work = 0.0;      ///< Units processed per run (0 if not given).
+  std::string work_unit;  ///< e.g. "bytes" or "elements".
+
+  /**
+   * @return work per second at the median time, or 0 without work units.
+   */
+  auto Throughput() const -> double;
+
+  auto ToJson() const -> std::string;
+};
+
+/**
+ * @brief Runs benchmark bodies with warmup and repetitions and collects
+ * percentile statistics.
+ *
+ * Results are written as JSON lines, one benchmark per line. A previous
+ * output can be loaded as a baseline to flag medians that got slower.
+ */
+class BenchmarkHarness {
+ public:
+  explicit BenchmarkHarness(BenchmarkOptions options);
+
+  /**
+   * @brief Times body; skipped if it does not match the filter.
+   * @param name Unique benchmark name.
+   * @param body Work to time. Side effects should be kept observable so
+   * the optimizer cannot drop them.
+   * @param work Units processed by one call, for throughput.
+   * @param work_unit Name of those units.
+   */
+  auto Run(const std::string& name, const std::function<void()>& body,
+           double work = 0.0, const std::string& work_unit = "") -> void;
+
+  auto results() const -> const std::vector<BenchmarkResult>& {
+    return results_;
+  }
+
+  /**
+   * @return One JSON object per line.
+   */
+  auto ToJsonLines() const -> std::string;
+
+  /**
+   * @brief Human-readable table of the results.
+   */
+  auto GenerateReport() const -> std::string;
+
+  /**
+   * @brief Reads the median of each benchmark from a JSON-lines output.
+   * @throws std::runtime_error if the file cannot be read.
+   */
+  static auto LoadBaseline(const std::string& filename)
+      -> std::map<std::string, double>;
+
+  /**
+   * @brief Compares medians against a baseline.
+   * @param baseline Median per benchmark name.
+   * @param tolerance Allowed relative slowdown, e.g. 0.10 for 10%.
+   * @param report Receives one line per compared benchmark.
+   * @return Number of benchmarks slower than allowed.
+   */
+  auto CompareWithBaseline(const std::map<std::string, double>& baseline,
+                           double tolerance, std::string& report) const
+      -> size_t;
+
+ private:
+  BenchmarkOptions options_;
+  std::vector<BenchmarkResult> results_;
+};
+
+/**
+ * @brief Keeps a value alive so the optimizer cannot drop the computation
+ * that produced it.
+ */
+template <typename T>
+inline auto DoNotOptimize(const T& value) -> void {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_BENCHMARK_HARNESS_H_
@@ -0,0 +1,110 @@
+#ifndef PARTITION_INCLUDE_BUFFERED_OUTPUT_H_
+#define PARTITION_INCLUDE_BUFFERED_OUTPUT_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the BufferedOutput class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <charconv>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Large write buffer in front of an std::ostream.
+ *
+ * Numbers are formatted with std::to_chars straight into the buffer, and
+ * the stream only sees one write per filled buffer, which keeps streaming
+ * hundreds of millions of lines I/O bound.
+ */
+class BufferedOutput {
+ public:
+  explicit BufferedOutput(std::ostream& output,
+                          size_t capacity = size_t{1} << 20)
+      : output_(output), buffer_(capacity), used_(0) {}
+
+  /**
+   * @brief Flushes; call Flush explicitly to check for write errors.
+   */
+  ~BufferedOutput() {
+    try {
+      Flush();
+    } catch (...) {
+    }
+  }
+
+  BufferedOutput(const BufferedOutput&) = delete;
+  auto operator=(const BufferedOutput&) -> BufferedOutput& = delete;
+
+  auto Append(char c) -> void {
+    Reserve(1);
+    buffer_[used_++] = c;
+  }
+
+  auto Append(std::string_view text) -> void {
+    if (text.size() > buffer_.size()) {
+      Flush();
+      output_.write(text.data(), static_cast<std::streamsize>(text.size()));
+      return;
+    }
+    Reserve(text.size());
+    text.copy(buffer_.data() + used_, text.size());
+    used_ += text.size();
+  }
+
+  template <typename Integer>
+  auto AppendNumber(Integer value) -> void {
+    Reserve(24);
+    auto result =
+        std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(),
+                      value);
+    used_ = static_cast<size_t>(result.ptr - buffer_.data());
+  }
+
+  /**
+   * @brief Appends a 32-bit little-endian integer.
+   */
+  auto AppendUint32(uint32_t value) -> void {
+    Reserve(4);
+    for (int i = 0; i < 4; ++i) {
+      buffer_[used_++] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+  }
+
+  /**
+   * @brief Writes the buffered bytes; check the stream state afterwards.
+   */
+  auto Flush() -> void {
+    if (used_ > 0) {
+      output_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+      used_ = 0;
+    }
+    output_.flush();
+  }
+
+ private:
+  auto Reserve(size_t bytes) -> void {
+    if (buffer_.size() - used_ < bytes) {
+      output_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+      used_ = 0;
+    }
+  }
+
+  std::ostream& output_;
+  std::vector<char> buffer_;
+  size_t used_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_BUFFERED_OUTPUT_H_
@@ -0,0 +1,130 @@
+#ifndef PARTITION_INCLUDE_GENERATOR_H_
+#define PARTITION_INCLUDE_GENERATOR_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the Generator coroutine type.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace partition {
+
+/**
+ * @brief Lazy sequence produced by a coroutine with co_yield.
+ *
+ * The coroutine runs only as far as the next co_yield each time the
+ * iterator advances, so values are produced one at a time and the
+ * sequence can be abandoned at any point. A yielded value is seen by
+ * reference and only lives until the next increment. Exceptions thrown
+ * by the coroutine surface from begin() or operator++. Move-only; a
+ * single pass.
+ * @tparam T Type of the yielded values.
+ */
+template <typename T>
+class Generator {
+ public:
+  struct promise_type {
+    const T* current = nullptr;
+    std::exception_ptr exception;
+
+    auto get_return_object() -> Generator {
+      return Generator(Handle::from_promise(*this));
+    }
+    auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+    auto final_suspend() noexcept -> std::suspend_always { return {}; }
+    auto yield_value(const T& value) noexcept -> std::suspend_always {
+      current = std::addressof(value);
+      return {};
+    }
+    auto return_void() noexcept -> void {}
+    auto unhandled_exception() -> void {
+      exception = std::current_exception();
+    }
+    /// Generators only yield; co_await is not supported.
+    template <typename U>
+    auto await_transform(U&& value) -> void = delete;
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+
+    Iterator() = default;
+    explicit Iterator(Handle handle) : handle_(handle) {}
+
+    auto operator*() const -> const T& { return *handle_.promise().current; }
+    auto operator->() const -> const T* { return handle_.promise().current; }
+    auto operator++() -> Iterator& {
+      Advance(handle_);
+      return *this;
+    }
+    auto operator++(int) -> void { ++*this; }
+    auto operator==(std::default_sentinel_t) const -> bool {
+      return !handle_ || handle_.done();
+    }
+
+   private:
+    Handle handle_;
+  };
+
+  Generator(Generator&& other) noexcept
+      : handle_(std::exchange(other.handle_, {})) {}
+  auto operator=(Generator&& other) noexcept -> Generator& {
+    if (this != &other) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+  Generator(const Generator&) = delete;
+  auto operator=(const Generator&) -> Generator& = delete;
+  ~Generator() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  /**
+   * @brief Runs the coroutine up to its first value.
+   */
+  auto begin() -> Iterator {
+    if (handle_) {
+      Advance(handle_);
+    }
+    return Iterator(handle_);
+  }
+  auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+ private:
+  explicit Generator(Handle handle) : handle_(handle) {}
+
+  static auto Advance(Handle handle) -> void {
+    handle.resume();
+    if (handle.promise().exception) {
+      std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+    }
+  }
+
+  Handle handle_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_GENERATOR_H_
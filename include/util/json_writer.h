@@ -0,0 +1,55 @@
+#ifndef PARTITION_INCLUDE_JSON_WRITER_H_
+#define PARTITION_INCLUDE_JSON_WRITER_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the JsonObjectWriter class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace partition {
+
+/**
+ * @brief Escapes a string for use inside a JSON string literal.
+ */
+auto JsonEscape(std::string_view text) -> std::string;
+
+/**
+ * @brief Builds one compact, single-line JSON object field by field.
+ *
+ * Values added with AddRaw are copied verbatim, which allows nesting
+ * objects or arrays built elsewhere.
+ */
+class JsonObjectWriter {
+ public:
+  auto Add(std::string_view key, std::string_view value) -> JsonObjectWriter&;
+  auto Add(std::string_view key, const char* value) -> JsonObjectWriter&;
+  auto Add(std::string_view key, bool value) -> JsonObjectWriter&;
+  auto Add(std::string_view key, int64_t value) -> JsonObjectWriter&;
+  auto Add(std::string_view key, uint64_t value) -> JsonObjectWriter&;
+  auto Add(std::string_view key, double value) -> JsonObjectWriter&;
+  auto AddRaw(std::string_view key, std::string_view json) -> JsonObjectWriter&;
+
+  /**
+   * @return The object, without a trailing newline.
+   */
+  auto ToString() const -> std::string;
+
+ private:
+  auto AppendKey(std::string_view key) -> void;
+
+  std::string body_;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_JSON_WRITER_H_
@@ -0,0 +1,137 @@
+#ifndef PARTITION_INCLUDE_MEMORY_ACCOUNTING_H_
+#define PARTITION_INCLUDE_MEMORY_ACCOUNTING_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the memory accounting utilities.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Memory resource that forwards to an upstream resource and counts
+ * the bytes it hands out.
+ *
+ * Counters are atomic, so one instance may back structures used from
+ * several threads. Deallocations are counted even when the upstream
+ * ignores them (as a monotonic_buffer_resource does), so bytes_in_use()
+ * is what the structures hold, not what the upstream reserved.
+ */
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit CountingMemoryResource(
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : upstream_(upstream) {}
+
+  CountingMemoryResource(const CountingMemoryResource&) = delete;
+  auto operator=(const CountingMemoryResource&)
+      -> CountingMemoryResource& = delete;
+
+  auto upstream() const -> std::pmr::memory_resource* { return upstream_; }
+
+  auto bytes_in_use() const -> size_t {
+    return in_use_.load(std::memory_order_relaxed);
+  }
+  auto peak_bytes() const -> size_t {
+    return peak_.load(std::memory_order_relaxed);
+  }
+  auto allocations() const -> size_t {
+    return allocations_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Starts a new peak window at the current usage, so peak_bytes()
+   * afterwards is the peak of the next phase.
+   */
+  auto ResetPeak() -> void {
+    peak_.store(bytes_in_use(), std::memory_order_relaxed);
+  }
+
+ protected:
+  auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+  auto do_deallocate(void* pointer, size_t bytes, size_t alignment)
+      -> void override;
+  auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override {
+    return this == &other;
+  }
+
+ private:
+  std::pmr::memory_resource* upstream_;
+  std::atomic<size_t> in_use_{0};
+  std::atomic<size_t> peak_{0};
+  std::atomic<size_t> allocations_{0};
+};
+
+/**
+ * @brief Shared byte budget that jobs reserve before they run.
+ *
+ * A reservation larger than the whole budget can never succeed and is
+ * refused; a smaller one waits until enough running jobs have released
+ * theirs.
+ */
+class MemoryBudget {
+ public:
+  /**
+   * @param limit Bytes available; 0 means unlimited.
+   */
+  explicit MemoryBudget(size_t limit) : limit_(limit) {}
+
+  auto limit() const -> size_t { return limit_; }
+
+  /**
+   * @brief Returns true if a reservation of bytes could ever be granted.
+   */
+  auto Fits(size_t bytes) const -> bool { return limit_ == 0 || bytes <= limit_; }
+
+  /**
+   * @brief Blocks until bytes are available and reserves them.
+   * @return false without waiting if the reservation does not fit at all.
+   */
+  auto Acquire(size_t bytes) -> bool;
+
+  auto Release(size_t bytes) -> void;
+
+  auto bytes_reserved() const -> size_t;
+
+ private:
+  size_t limit_;
+  size_t reserved_ = 0;
+  mutable std::mutex mutex_;
+  std::condition_variable released_;
+};
+
+/**
+ * @brief Peak resident set size of the process so far, in bytes.
+ */
+auto PeakResidentBytes() -> size_t;
+
+/**
+ * @brief Parses a byte count with an optional K, M or G suffix (powers of
+ * 1024), e.g. "512M".
+ * @throws std::invalid_argument if the text is not a size.
+ */
+auto ParseByteSize(const std::string& text) -> size_t;
+
+/**
+ * @brief Bytes a std::pmr::string of the given length keeps outside the
+ * object, 0 when it fits in the small string buffer.
+ */
+auto StringHeapBytes(size_t length) -> size_t;
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_MEMORY_ACCOUNTING_H_
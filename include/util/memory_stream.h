@@ -0,0 +1,67 @@
+#ifndef PARTITION_INCLUDE_MEMORY_STREAM_H_
+#define PARTITION_INCLUDE_MEMORY_STREAM_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the MemoryInputStream class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <istream>
+#include <streambuf>
+#include <string_view>
+
+namespace partition {
+
+/**
+ * @brief Read-only stream buffer over memory it does not own.
+ */
+class MemoryStreamBuf : public std::streambuf {
+ public:
+  explicit MemoryStreamBuf(std::string_view data) {
+    auto* begin = const_cast<char*>(data.data());
+    setg(begin, begin, begin + data.size());
+  }
+
+ protected:
+  /// Lets tellg and seekg work, so readers can see how much is left.
+  auto seekoff(off_type offset, std::ios_base::seekdir direction,
+               std::ios_base::openmode which) -> pos_type override {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+    off_type base = direction == std::ios_base::beg   ? 0
+                    : direction == std::ios_base::cur ? gptr() - eback()
+                                                      : egptr() - eback();
+    off_type target = base + offset;
+    if (target < 0 || target > egptr() - eback()) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + target, egptr());
+    return pos_type(target);
+  }
+
+  auto seekpos(pos_type position, std::ios_base::openmode which)
+      -> pos_type override {
+    return seekoff(off_type(position), std::ios_base::beg, which);
+  }
+};
+
+/**
+ * @brief std::istream reading from memory without copying it, so the
+ * stream-based readers can parse received or mapped buffers in place.
+ */
+class MemoryInputStream : private MemoryStreamBuf, public std::istream {
+ public:
+  explicit MemoryInputStream(std::string_view data)
+      : MemoryStreamBuf(data), std::istream(static_cast<MemoryStreamBuf*>(this)) {}
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_MEMORY_STREAM_H_
@@ -0,0 +1,175 @@
+#ifndef PARTITION_INCLUDE_METRICS_H_
+#define PARTITION_INCLUDE_METRICS_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the per-phase instrumentation layer.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace partition {
+
+/**
+ * @brief Timed phases of a run.
+ */
+enum class MetricsPhase {
+  kParse,
+  kIndexMap,
+  kWeights,
+  kWrite,
+  kSolve,
+  kMapBack,
+  kVerify,
+  kCount
+};
+
+/**
+ * @brief Event counters.
+ */
+enum class MetricsCounter {
+  kBytesParsed,
+  kTriplesReduced,
+  kNodesExplored,
+  kDpWordsTouched,
+  kTranspositionHits,
+  kFilterRejections,
+  kCount
+};
+
+/**
+ * @brief Process-wide totals per phase and per counter.
+ *
+ * Updates are relaxed atomic adds, so instrumented code may run on any
+ * number of threads. Hot loops should count locally and add once.
+ *
+ * Collection is compiled in only with PARTITION_ENABLE_METRICS (CMake
+ * option of the same name); otherwise the macros below expand to nothing
+ * and the registry stays at zero, though it can still be exported.
+ */
+class MetricsRegistry {
+ public:
+  static auto Global() -> MetricsRegistry&;
+
+  static constexpr auto Enabled() -> bool {
+#ifdef PARTITION_ENABLE_METRICS
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  auto AddPhase(MetricsPhase phase, uint64_t nanoseconds) -> void {
+    auto& slot = phases_[static_cast<size_t>(phase)];
+    slot.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto Add(MetricsCounter counter, uint64_t amount) -> void {
+    counters_[static_cast<size_t>(counter)].fetch_add(
+        amount, std::memory_order_relaxed);
+  }
+
+  auto phase_nanoseconds(MetricsPhase phase) const -> uint64_t {
+    return phases_[static_cast<size_t>(phase)].nanoseconds.load(
+        std::memory_order_relaxed);
+  }
+  auto phase_calls(MetricsPhase phase) const -> uint64_t {
+    return phases_[static_cast<size_t>(phase)].calls.load(
+        std::memory_order_relaxed);
+  }
+  auto counter(MetricsCounter counter) const -> uint64_t {
+    return counters_[static_cast<size_t>(counter)].load(
+        std::memory_order_relaxed);
+  }
+
+  auto Reset() -> void;
+
+  /**
+   * @brief One JSON object with "phases" (seconds and calls) and
+   * "counters".
+   */
+  auto ToJson() const -> std::string;
+
+  /**
+   * @brief Prometheus text exposition format.
+   */
+  auto ToPrometheus() const -> std::string;
+
+  /**
+   * @brief Writes Prometheus text if filename ends in ".prom", JSON
+   * otherwise.
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  auto WriteToFile(const std::string& filename) const -> void;
+
+  static auto PhaseName(MetricsPhase phase) -> const char*;
+  static auto CounterName(MetricsCounter counter) -> const char*;
+
+ private:
+  struct PhaseSlot {
+    std::atomic<uint64_t> nanoseconds{0};
+    std::atomic<uint64_t> calls{0};
+  };
+
+  std::array<PhaseSlot, static_cast<size_t>(MetricsPhase::kCount)> phases_;
+  std::array<std::atomic<uint64_t>, static_cast<size_t>(MetricsCounter::kCount)>
+      counters_{};
+};
+
+/**
+ * @brief Adds the lifetime of the object to a phase.
+ */
+class ScopedPhaseTimer {
+ public:
+  explicit ScopedPhaseTimer(MetricsPhase phase)
+      : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+  ~ScopedPhaseTimer() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    MetricsRegistry::Global().AddPhase(
+        phase_, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        elapsed)
+                        .count()));
+  }
+
+  ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+  auto operator=(const ScopedPhaseTimer&) -> ScopedPhaseTimer& = delete;
+
+ private:
+  MetricsPhase phase_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace partition
+
+#define PARTITION_METRICS_CONCAT_INNER(a, b) a##b
+#define PARTITION_METRICS_CONCAT(a, b) PARTITION_METRICS_CONCAT_INNER(a, b)
+
+#ifdef PARTITION_ENABLE_METRICS
+/// Times the rest of the enclosing scope as the given MetricsPhase.
+#define PARTITION_METRICS_PHASE(phase)                             \
+  ::partition::ScopedPhaseTimer PARTITION_METRICS_CONCAT(          \
+      partition_metrics_timer_, __LINE__)(::partition::MetricsPhase::phase)
+/// Adds amount to the given MetricsCounter.
+#define PARTITION_METRICS_COUNT(counter, amount)                  \
+  ::partition::MetricsRegistry::Global().Add(                     \
+      ::partition::MetricsCounter::counter, static_cast<uint64_t>(amount))
+#else
+#define PARTITION_METRICS_PHASE(phase) static_cast<void>(0)
+// sizeof keeps locals that only feed a counter "used" without evaluating.
+#define PARTITION_METRICS_COUNT(counter, amount) \
+  static_cast<void>(sizeof(amount))
+#endif
+
+#endif  // PARTITION_INCLUDE_METRICS_H_
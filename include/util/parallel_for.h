@@ -0,0 +1,67 @@
+#ifndef PARTITION_INCLUDE_PARALLEL_FOR_H_
+#define PARTITION_INCLUDE_PARALLEL_FOR_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ParallelFor helper.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Thread count to use for a request; 0 means
+ * std::thread::hardware_concurrency.
+ */
+inline auto ResolveThreads(size_t threads) -> size_t {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  return std::max<size_t>(1, threads);
+}
+
+/**
+ * @brief Splits [0, count) into one contiguous chunk per thread, calls
+ * body(begin, end) on each and waits for all of them.
+ *
+ * Meant for short, evenly sized data-parallel loops, where a pool and its
+ * queue cost more than they save. A single chunk runs on the caller. The
+ * body must not throw.
+ * @param threads Number of threads; 0 means
+ * std::thread::hardware_concurrency.
+ */
+template <typename Body>
+auto ParallelFor(size_t count, size_t threads, const Body& body) -> void {
+  threads = std::min(ResolveThreads(threads), count);
+  if (threads <= 1) {
+    if (count > 0) {
+      body(size_t{0}, count);
+    }
+    return;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_t t = 1; t < threads; ++t) {
+    workers.emplace_back([&body, count, threads, t] {
+      body(count * t / threads, count * (t + 1) / threads);
+    });
+  }
+  body(size_t{0}, count / threads);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_PARALLEL_FOR_H_
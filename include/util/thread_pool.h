@@ -0,0 +1,76 @@
+#ifndef PARTITION_INCLUDE_THREAD_POOL_H_
+#define PARTITION_INCLUDE_THREAD_POOL_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the ThreadPool class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Fixed-size pool of worker threads sharing one task queue.
+ *
+ * Tasks receive the index of the worker running them, so callers can keep
+ * warm per-worker state (reducers, solvers, arenas) without locking.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @param threads Number of workers; 0 means std::thread::hardware_concurrency.
+   */
+  explicit ThreadPool(size_t threads = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+  /**
+   * @brief Queues a task.
+   * @param task Callable taking the worker index.
+   * @return Future with the task result.
+   */
+  template <typename Task>
+  auto Submit(Task task) -> std::future<std::invoke_result_t<Task, size_t>> {
+    using Result = std::invoke_result_t<Task, size_t>;
+    auto packaged =
+        std::make_shared<std::packaged_task<Result(size_t)>>(std::move(task));
+    auto future = packaged->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.emplace_back(
+          [packaged](size_t worker) { (*packaged)(worker); });
+    }
+    condition_.notify_one();
+    return future;
+  }
+
+  auto size() const -> size_t { return workers_.size(); }
+
+ private:
+  auto WorkerLoop(size_t worker) -> void;
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void(size_t)>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_THREAD_POOL_H_
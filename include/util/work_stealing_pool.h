@@ -0,0 +1,86 @@
+#ifndef PARTITION_INCLUDE_WORK_STEALING_POOL_H_
+#define PARTITION_INCLUDE_WORK_STEALING_POOL_H_
+
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Header file for the WorkStealingPool class.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace partition {
+
+/**
+ * @brief Thread pool with one task deque per worker.
+ *
+ * Workers pop their own deque from the back and, once it is empty, steal
+ * from the front of the others, so a worker stuck on a large instance does
+ * not hold back the small ones queued behind it. Tasks submitted from
+ * outside the pool are dealt round-robin; tasks submitted by a worker go
+ * to its own deque.
+ */
+class WorkStealingPool {
+ public:
+  using Task = std::function<void(size_t worker)>;
+
+  /**
+   * @param threads Number of workers; 0 means std::thread::hardware_concurrency.
+   */
+  explicit WorkStealingPool(size_t threads = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  auto operator=(const WorkStealingPool&) -> WorkStealingPool& = delete;
+
+  /**
+   * @brief Queues a task. The task receives the index of the worker that
+   * runs it. Exceptions escaping a task terminate the program, so tasks
+   * must report their own errors.
+   */
+  auto Submit(Task task) -> void;
+
+  /**
+   * @brief Blocks until every submitted task has finished.
+   */
+  auto WaitIdle() -> void;
+
+  auto size() const -> size_t { return workers_.size(); }
+
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  auto WorkerLoop(size_t worker) -> void;
+  auto TryPop(size_t worker, Task& task) -> bool;
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_queue_{0};
+
+  // Guards sleeping and the two counters below.
+  std::mutex state_mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable idle_;
+  size_t queued_ = 0;      ///< Tasks waiting in some deque.
+  size_t unfinished_ = 0;  ///< Tasks queued or running.
+  bool stopping_ = false;
+};
+
+}  // namespace partition
+
+#endif  // PARTITION_INCLUDE_WORK_STEALING_POOL_H_
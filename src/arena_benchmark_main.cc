@@ -0,0 +1,200 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Compares default allocation with a monotonic arena when reading and
+ * dropping large instances.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/partition_reader.h"
+#include "io/three_d_m_reader.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+// Every global allocation goes through here, including the upstream
+// allocations made by std::pmr::new_delete_resource().
+size_t g_allocation_count = 0;
+
+/**
+ * @brief Generates a random 3DM instance in the text format.
+ * Element names are longer than the small string buffer on purpose so that
+ * each one costs a heap allocation, as with real-world ids.
+ */
+auto GenerateThreeDMText(size_t q, size_t k, uint64_t seed) -> std::string {
+  std::mt19937_64 rng(seed);
+  std::ostringstream out;
+  char name[32];
+  out << q << '\n';
+  for (char set : {'w', 'x', 'y'}) {
+    for (size_t i = 0; i < q; ++i) {
+      std::snprintf(name, sizeof(name), "%c_element_%08zu ", set, i);
+      out << name;
+    }
+    out << '\n';
+  }
+  for (size_t t = 0; t < k; ++t) {
+    for (char set : {'w', 'x', 'y'}) {
+      std::snprintf(name, sizeof(name), "%c_element_%08zu ", set,
+                    static_cast<size_t>(rng() % q));
+      out << name;
+    }
+    out << '\n';
+  }
+  return out.str();
+}
+
+/**
+ * @brief Generates a random Partition instance in the text format.
+ */
+auto GeneratePartitionText(size_t n, uint64_t seed) -> std::string {
+  std::mt19937_64 rng(seed);
+  std::ostringstream out;
+  char name[32];
+  out << n << '\n';
+  for (size_t i = 0; i < n; ++i) {
+    std::snprintf(name, sizeof(name), "element_%010zu ", i);
+    out << name << (rng() % 1000000 + 1) << '\n';
+  }
+  return out.str();
+}
+
+struct RunResult {
+  size_t allocations = 0;
+  double milliseconds = 0.0;
+};
+
+/**
+ * @brief Reads both instances from text and drops them, optionally using a
+ * monotonic arena released in one step at the end.
+ */
+auto RunOnce(const std::string& three_dm_text,
+             const std::string& partition_text, bool use_arena)
+    -> RunResult {
+  std::istringstream three_dm_input(three_dm_text);
+  std::istringstream partition_input(partition_text);
+  RunResult result;
+  auto allocations_before = g_allocation_count;
+  auto start = std::chrono::steady_clock::now();
+  {
+    std::pmr::monotonic_buffer_resource arena(1 << 20);
+    auto* resource =
+        use_arena ? static_cast<std::pmr::memory_resource*>(&arena)
+                  : std::pmr::get_default_resource();
+    {
+      partition::ThreeDMReader three_dm_reader(resource);
+      partition::PartitionReader partition_reader(resource);
+      auto three_dm = three_dm_reader.ReadFromStream(three_dm_input);
+      auto partition_instance =
+          partition_reader.ReadFromStream(partition_input);
+      if (three_dm.triples().empty() || partition_instance.size() == 0) {
+        std::cerr << "Unexpected empty instance" << std::endl;
+      }
+    }
+    arena.release();
+  }
+  auto end = std::chrono::steady_clock::now();
+  result.allocations = g_allocation_count - allocations_before;
+  result.milliseconds =
+      std::chrono::duration<double, std::milli>(end - start).count();
+  return result;
+}
+
+}  // namespace
+
+auto operator new(std::size_t size) -> void* {
+  ++g_allocation_count;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+  ++g_allocation_count;
+  auto align = static_cast<std::size_t>(alignment);
+  auto rounded = (size + align - 1) / align * align;
+  if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::align_val_t) noexcept -> void {
+  std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+    -> void {
+  std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void {
+  std::free(ptr);
+}
+
+int main(int argc, char* argv[]) {
+  size_t q = 1000;
+  size_t k = 200000;
+  size_t n = 500000;
+  size_t repetitions = 5;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "-q") == 0 && i + 1 < argc) {
+      q = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+      k = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      n = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      repetitions = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [-q <q>] [-k <triples>] [-n <partition elements>]"
+                   " [-r <repetitions>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  auto three_dm_text = GenerateThreeDMText(q, k, 42);
+  auto partition_text = GeneratePartitionText(n, 43);
+  std::cout << "3DM: q=" << q << " k=" << k << " ("
+            << three_dm_text.size() / 1024 << " KiB), Partition: n=" << n
+            << " (" << partition_text.size() / 1024 << " KiB), "
+            << repetitions << " repetitions" << std::endl;
+
+  try {
+    for (bool use_arena : {false, true}) {
+      RunResult best{0, 0.0};
+      for (size_t r = 0; r < repetitions; ++r) {
+        auto result = RunOnce(three_dm_text, partition_text, use_arena);
+        if (r == 0 || result.milliseconds < best.milliseconds) {
+          best = result;
+        }
+      }
+      std::cout << (use_arena ? "monotonic arena " : "default resource")
+                << "  allocations: " << best.allocations
+                << "  best time: " << best.milliseconds << " ms" << std::endl;
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,640 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Benchmark suite covering the readers, the reduction, the writer,
+ * the solvers and the verifier.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance_builder.h"
+#include "core/triple_conflict_index.h"
+#include "core/weight_width.h"
+#include "generators/three_d_m_generator.h"
+#include "io/partition_reader.h"
+#include "io/partition_writer.h"
+#include "io/three_d_m_reader.h"
+#include "reduction/feasibility_precheck.h"
+#include "reduction/three_d_m_to_partition_reducer.h"
+#include "solvers/bitmap_verifier.h"
+#include "solvers/component_solver.h"
+#include "solvers/local_search_solver.h"
+#include "solvers/matching_counter.h"
+#include "solvers/partition_approximator.h"
+#include "solvers/partition_counter.h"
+#include "solvers/partition_filter.h"
+#include "solvers/partition_solver.h"
+#include "solvers/reduced_partition_solver.h"
+#include "solvers/solver_cost_model.h"
+#include "solvers/solution_verifier.h"
+#include "solvers/weighted_partition_solver.h"
+#include "solvers/width_dispatch_solver.h"
+#include "util/benchmark_harness.h"
+#include "util/memory_stream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Generates a 3DM instance in the text format with a planted perfect
+ * matching in its first q triples, so every element is covered and the
+ * reduction is well defined.
+ */
+auto GenerateThreeDMText(size_t q, size_t k, uint64_t seed) -> std::string {
+  std::mt19937_64 rng(seed);
+  std::vector<size_t> x(q);
+  std::vector<size_t> y(q);
+  std::iota(x.begin(), x.end(), 1);
+  std::iota(y.begin(), y.end(), 1);
+  std::shuffle(x.begin(), x.end(), rng);
+  std::shuffle(y.begin(), y.end(), rng);
+  std::ostringstream out;
+  out << q << '\n';
+  for (char set : {'w', 'x', 'y'}) {
+    for (size_t i = 1; i <= q; ++i) {
+      out << set << i << ' ';
+    }
+    out << '\n';
+  }
+  for (size_t t = 0; t < k; ++t) {
+    if (t < q) {
+      out << 'w' << t + 1 << " x" << x[t] << " y" << y[t] << '\n';
+    } else {
+      out << 'w' << rng() % q + 1 << " x" << rng() % q + 1 << " y"
+          << rng() % q + 1 << '\n';
+    }
+  }
+  return out.str();
+}
+
+/**
+ * @brief Generates a 3DM instance made of independent blocks, each with q
+ * elements per set, k triples and a planted perfect matching.
+ */
+auto GenerateBlockThreeDMText(size_t blocks, size_t q, size_t k,
+                              uint64_t seed) -> std::string {
+  std::mt19937_64 rng(seed);
+  std::ostringstream out;
+  out << blocks * q << '\n';
+  for (char set : {'w', 'x', 'y'}) {
+    for (size_t b = 0; b < blocks; ++b) {
+      for (size_t i = 0; i < q; ++i) {
+        out << set << b << '_' << i << ' ';
+      }
+    }
+    out << '\n';
+  }
+  std::vector<size_t> x(q);
+  std::vector<size_t> y(q);
+  for (size_t b = 0; b < blocks; ++b) {
+    std::iota(x.begin(), x.end(), 0);
+    std::iota(y.begin(), y.end(), 0);
+    std::shuffle(x.begin(), x.end(), rng);
+    std::shuffle(y.begin(), y.end(), rng);
+    for (size_t t = 0; t < k; ++t) {
+      bool planted = t < q;
+      out << 'w' << b << '_' << (planted ? t : rng() % q) << " x" << b << '_'
+          << (planted ? x[t] : rng() % q) << " y" << b << '_'
+          << (planted ? y[t] : rng() % q) << '\n';
+    }
+  }
+  return out.str();
+}
+
+/**
+ * @brief Generates a solvable Partition instance: sizes come in equal
+ * pairs, and the even-indexed elements form one half.
+ */
+auto GeneratePartition(size_t pairs, uint64_t max_size, uint64_t seed)
+    -> partition::PartitionInstance {
+  std::mt19937_64 rng(seed);
+  partition::PartitionInstanceBuilder builder;
+  builder.Reserve(2 * pairs);
+  char name[32];
+  for (size_t i = 0; i < pairs; ++i) {
+    auto size = static_cast<int64_t>(rng() % max_size + 1);
+    std::snprintf(name, sizeof(name), "e%zu", 2 * i);
+    builder.EmplaceElement(name, size);
+    std::snprintf(name, sizeof(name), "e%zu", 2 * i + 1);
+    builder.EmplaceElement(name, size);
+  }
+  return builder.Build();
+}
+
+auto EvenHalf(const partition::PartitionInstance& instance)
+    -> std::set<std::string> {
+  std::set<std::string> subset;
+  for (size_t i = 0; i < instance.elements().size(); i += 2) {
+    subset.emplace(instance.elements()[i].id());
+  }
+  return subset;
+}
+
+auto PartitionText(const partition::PartitionInstance& instance)
+    -> std::string {
+  std::ostringstream out;
+  partition::PartitionWriter().WriteToStream(instance, out);
+  return out.str();
+}
+
+}  // namespace
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== BENCHMARK SUITE ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " [options]" << std::endl << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "  -w <n>         Warmup runs per benchmark (default: 3)" << std::endl;
+  std::cout << "  -r <n>         Timed repetitions per benchmark (default: 20)" << std::endl;
+  std::cout << "  -f <text>      Only run benchmarks whose name contains text" << std::endl;
+  std::cout << "  -o <file>      Write the results as JSON lines" << std::endl;
+  std::cout << "  -b <file>      Compare medians with a previous -o output" << std::endl;
+  std::cout << "  -t <percent>   Allowed slowdown before failing (default: 10)" << std::endl;
+  std::cout << "  -c <file>      Calibrate the solver cost model on the solve/* cases and" << std::endl;
+  std::cout << "                 write it (for --cost-model of the pipeline and server)" << std::endl;
+  std::cout << "  -h, --help     Show this help message" << std::endl << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  partition::BenchmarkOptions options;
+  std::string output_file;
+  std::string baseline_file;
+  std::string cost_model_file;
+  double tolerance_percent = 10.0;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((std::strcmp(argv[i], "-h") == 0) || (std::strcmp(argv[i], "--help") == 0)) {
+      PrintHelp(argv[0]);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+      options.warmup = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      options.repetitions = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      options.filter = argv[++i];
+    } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_file = argv[++i];
+    } else if (std::strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      baseline_file = argv[++i];
+    } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      tolerance_percent = std::stod(argv[++i]);
+    } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      cost_model_file = argv[++i];
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << std::endl;
+      PrintHelp(argv[0]);
+      return 1;
+    }
+  }
+
+  try {
+    partition::BenchmarkHarness harness(options);
+    // Last difference reached by each minimum-difference heuristic case.
+    std::map<std::string, uint64_t> differences;
+
+    // -------------- READERS --------------
+    for (size_t q : {100, 10000}) {
+      auto text = GenerateThreeDMText(q, 3 * q, q);
+      harness.Run("read/3dm/q=" + std::to_string(q), [&] {
+        partition::MemoryInputStream input(text);
+        auto instance = partition::ThreeDMReader().ReadFromStream(input);
+        partition::DoNotOptimize(instance.triples().size());
+      }, static_cast<double>(text.size()), "bytes");
+    }
+    for (size_t pairs : {500, 50000}) {
+      auto text = PartitionText(GeneratePartition(pairs, 1000000, pairs));
+      harness.Run("read/partition/n=" + std::to_string(2 * pairs), [&] {
+        partition::MemoryInputStream input(text);
+        auto instance = partition::PartitionReader().ReadFromStream(input);
+        partition::DoNotOptimize(instance.total_sum());
+      }, static_cast<double>(text.size()), "bytes");
+    }
+
+    // -------------- REDUCTION --------------
+    // Reduce needs 3qp + 2 <= 63 bits, so it only scales over tiny q;
+    // ReduceCompact covers the larger sizes.
+    partition::ThreeDMToPartitionReducer reducer;
+    for (auto [q, k] : {std::pair<size_t, size_t>{4, 4}, {4, 31}, {6, 7}}) {
+      auto text = GenerateThreeDMText(q, k, q * k);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      harness.Run("reduce/q=" + std::to_string(q) + ",k=" + std::to_string(k), [&] {
+        auto reduced = reducer.Reduce(instance);
+        partition::DoNotOptimize(reduced.total_sum());
+      }, static_cast<double>(k), "triples");
+    }
+    for (size_t q : {100, 1000, 10000}) {
+      for (size_t factor : {1, 4}) {
+        size_t k = factor * q;
+        auto text = GenerateThreeDMText(q, k, q + k);
+        partition::MemoryInputStream input(text);
+        auto instance = partition::ThreeDMReader().ReadFromStream(input);
+        harness.Run("reduce_compact/q=" + std::to_string(q) + ",k=" + std::to_string(k), [&] {
+          auto reduced = reducer.ReduceCompact(instance);
+          partition::DoNotOptimize(reduced.size());
+        }, static_cast<double>(k), "triples");
+      }
+    }
+
+    // Fixed weight widths: q and k chosen so the totals need 32, 62 and
+    // 122 bits.
+    for (auto [q, k] : {std::pair<size_t, size_t>{2, 31}, {4, 31}, {8, 31}}) {
+      auto text = GenerateThreeDMText(q, k, q * k);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      auto width = partition::WeightWidthFor(
+          partition::ThreeDMToPartitionReducer::WeightBits(q, k));
+      auto suffix = std::string(partition::WeightWidthName(width)) + "/q=" +
+                    std::to_string(q) + ",k=" + std::to_string(k);
+      partition::VisitWeightWidth(width, [&](auto tag) {
+        using Weight = typename decltype(tag)::type;
+        harness.Run("reduce_weights/" + suffix, [&] {
+          auto weighted = reducer.ReduceToWeights<Weight>(instance);
+          partition::DoNotOptimize(weighted.size());
+        }, static_cast<double>(k), "triples");
+        auto weighted = reducer.ReduceToWeights<Weight>(instance);
+        partition::WeightedPartitionSolver<Weight> solver(
+            partition::PartitionSolver::Algorithm::kGreedyHeuristic);
+        harness.Run("solve_width/greedy/" + suffix, [&] {
+          auto solution = solver.Solve(weighted);
+          partition::DoNotOptimize(solution.has_value());
+        }, static_cast<double>(weighted.size()), "elements");
+      });
+    }
+
+    // The per-instance width dispatch against the exact cover it falls
+    // back to, on narrow reductions with and without a matching; on the
+    // latter the weighted search runs out of budget.
+    for (bool matching : {true, false}) {
+      partition::ThreeDMGeneratorOptions options;
+      options.q = 3;
+      options.k = 2000;
+      options.seed = 53;
+      options.answer =
+          matching ? partition::ThreeDMGeneratorOptions::Answer::kPlanted
+                   : partition::ThreeDMGeneratorOptions::Answer::kNoMatching;
+      std::ostringstream generated;
+      partition::ThreeDMGenerator(options).Generate(generated);
+      auto text = generated.str();
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      auto reduced = reducer.ReduceCompact(instance);
+      auto suffix = std::string(matching ? "matching" : "no_matching") +
+                    "/q=3,k=2000";
+      partition::WidthDispatchSolver dispatch_solver(
+          partition::PartitionSolver::Algorithm::kAuto);
+      harness.Run("solve_width/dispatch/" + suffix, [&] {
+        partition::DoNotOptimize(dispatch_solver.Solve(reduced).has_value());
+      }, static_cast<double>(reduced.size()), "elements");
+      partition::ReducedPartitionSolver cover_solver;
+      harness.Run("solve_width/exact_cover/" + suffix, [&] {
+        partition::DoNotOptimize(cover_solver.Solve(reduced).has_value());
+      }, static_cast<double>(reduced.size()), "elements");
+    }
+    {
+      // w1, x3 and y3 are uncovered, so b1 = 2T - B would be negative.
+      std::string text =
+          "3\nw1 w2 w3\nx1 x2 x3\ny1 y2 y3\nw2 x1 y1\nw3 x2 y2\n";
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      auto reduced = reducer.ReduceCompact(instance);
+      partition::WidthDispatchSolver dispatch_solver(
+          partition::PartitionSolver::Algorithm::kAuto);
+      harness.Run("solve_width/dispatch/uncovered/q=3,k=2", [&] {
+        partition::DoNotOptimize(dispatch_solver.Solve(reduced).has_value());
+      }, static_cast<double>(reduced.size()), "elements");
+    }
+
+    // Conflict index: with bitsets up to 8192 triples, posting lists only
+    // beyond.
+    for (auto [q, k] : {std::pair<size_t, size_t>{2000, 6000}, {20000, 60000}}) {
+      auto text = GenerateThreeDMText(q, k, q + 2 * k);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      harness.Run("conflict_index/q=" + std::to_string(q) + ",k=" + std::to_string(k), [&] {
+        partition::TripleConflictIndex index(instance);
+        partition::DoNotOptimize(index.triple_count());
+      }, static_cast<double>(k), "triples");
+    }
+
+    {
+      size_t q = 10000;
+      auto text = GenerateThreeDMText(q, 3 * q, 19);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      partition::FeasibilityPrecheck precheck;
+      harness.Run("precheck/q=10000,k=30000", [&] {
+        partition::DoNotOptimize(precheck.Check(instance).has_value());
+      }, static_cast<double>(3 * q), "triples");
+    }
+
+    // Partition filter: random sizes, where every residue fills quickly,
+    // and multiples of 122 plus sizes 1 and 3, rejected modulo 61.
+    {
+      partition::PartitionFilter filter(1);
+      auto random = GeneratePartition(50000, 1000000, 13);
+      harness.Run("filter/random/n=100000", [&] {
+        partition::DoNotOptimize(filter.Check(random).has_value());
+      }, static_cast<double>(random.size()), "elements");
+      partition::PartitionInstanceBuilder builder;
+      std::mt19937_64 rng(17);
+      char name[32];
+      for (size_t i = 0; i < 100000; ++i) {
+        std::snprintf(name, sizeof(name), "e%zu", i);
+        builder.EmplaceElement(name,
+                               static_cast<int64_t>(122 * (rng() % 1000 + 1)));
+      }
+      builder.EmplaceElement("one", 1);
+      builder.EmplaceElement("three", 3);
+      auto residue = builder.Build();
+      harness.Run("filter/residue/n=100002", [&] {
+        partition::DoNotOptimize(filter.Check(residue).has_value());
+      }, static_cast<double>(residue.size()), "elements");
+    }
+
+    // -------------- WRITER --------------
+    {
+      auto instance = GeneratePartition(50000, 1000000, 7);
+      harness.Run("write/partition/n=100000", [&] {
+        std::ostringstream out;
+        partition::PartitionWriter().WriteToStream(instance, out);
+        partition::DoNotOptimize(out.tellp());
+      }, static_cast<double>(instance.size()), "elements");
+    }
+
+    // -------------- SOLVERS --------------
+    struct SolverCase {
+      partition::PartitionSolver::Algorithm algorithm;
+      const char* name;
+      size_t pairs;
+      uint64_t max_size;
+    };
+    const SolverCase solver_cases[] = {
+        {partition::PartitionSolver::Algorithm::kDynamicProgramming, "dp", 100, 1000},
+        {partition::PartitionSolver::Algorithm::kDynamicProgramming, "dp", 500, 5000},
+        {partition::PartitionSolver::Algorithm::kDynamicProgramming, "dp", 2500, 50},
+        {partition::PartitionSolver::Algorithm::kMultisetDynamicProgramming, "multiset_dp", 2500, 50},
+        {partition::PartitionSolver::Algorithm::kDynamicProgramming, "dp", 20000, 100},
+        {partition::PartitionSolver::Algorithm::kSumsetConvolution, "sumset", 20000, 100},
+        {partition::PartitionSolver::Algorithm::kBacktracking, "backtracking", 12, 1000000},
+        {partition::PartitionSolver::Algorithm::kBacktracking, "backtracking", 500, 1000},
+        {partition::PartitionSolver::Algorithm::kGreedyHeuristic, "greedy", 50000, 1000000},
+        // The cost model's picks, next to the fixed engines above.
+        {partition::PartitionSolver::Algorithm::kAuto, "auto", 12, 1000000},
+        {partition::PartitionSolver::Algorithm::kAuto, "auto", 500, 5000},
+        {partition::PartitionSolver::Algorithm::kAuto, "auto", 2500, 50},
+    };
+    std::vector<partition::CostSample> cost_samples;
+    for (const auto& solver_case : solver_cases) {
+      auto instance = GeneratePartition(solver_case.pairs, solver_case.max_size,
+                                        solver_case.pairs * 31 + solver_case.max_size);
+      partition::PartitionSolver solver(solver_case.algorithm);
+      auto name = std::string("solve/") + solver_case.name + "/n=" +
+                  std::to_string(instance.size()) + ",max=" +
+                  std::to_string(solver_case.max_size);
+      harness.Run(name,
+                  [&] {
+                    auto solution = solver.Solve(instance);
+                    partition::DoNotOptimize(solution.has_value());
+                  },
+                  static_cast<double>(instance.size()), "elements");
+      if (solver_case.algorithm != partition::PartitionSolver::Algorithm::kAuto &&
+          !harness.results().empty() && harness.results().back().name == name) {
+        cost_samples.push_back({solver_case.algorithm,
+                                partition::ExtractFeatures(instance),
+                                harness.results().back().p50_ms});
+      }
+    }
+    // No perfect split, and none of the filter's checks see it: multiples
+    // of 3 plus one size = 1 (mod 3). Past the phase transition, so auto
+    // tries backtracking first and must hand over to the DP in time.
+    {
+      std::mt19937_64 rng(47);
+      partition::PartitionInstanceBuilder builder;
+      uint64_t total = 0;
+      char name[32];
+      for (size_t i = 0; i < 59; ++i) {
+        uint64_t size = 3 * (rng() % (uint64_t{1} << 20) + 1);
+        total += size;
+        std::snprintf(name, sizeof(name), "e%zu", i);
+        builder.EmplaceElement(name, static_cast<int64_t>(size));
+      }
+      builder.EmplaceElement("odd", total % 2 == 0 ? 4 : 1);
+      auto instance = builder.Build();
+      partition::PartitionSolver solver(partition::PartitionSolver::Algorithm::kAuto);
+      harness.Run("solve/auto/no_split/n=60,max=3*2^20", [&] {
+        partition::DoNotOptimize(solver.Solve(instance).has_value());
+      }, static_cast<double>(instance.size()), "elements");
+    }
+    if (!cost_model_file.empty()) {
+      partition::SolverCostModel model;
+      model.Calibrate(cost_samples);
+      model.WriteToFile(cost_model_file);
+    }
+
+    // Large-target DP: the bitset pass on the calling thread against the
+    // block-sliced pass on every core.
+    {
+      auto instance = GeneratePartition(100, uint64_t{1} << 19, 43);
+      for (size_t threads : {size_t{1}, size_t{0}}) {
+        partition::PartitionSolver solver(
+            partition::PartitionSolver::Algorithm::kDynamicProgramming);
+        solver.SetDynamicProgrammingThreads(threads);
+        harness.Run(std::string("solve_dp/threads=") +
+                        (threads == 0 ? "all" : "1") + "/n=200,max=2^19",
+                    [&] {
+                      partition::DoNotOptimize(solver.Solve(instance).has_value());
+                    },
+                    static_cast<double>(instance.size()), "elements");
+      }
+    }
+
+    // Minimum-difference splits: exact on an odd total, where no split is
+    // perfect, and the approximation scheme on weights far beyond the DP.
+    {
+      auto instance = GeneratePartition(500, 5000, 23);
+      partition::PartitionInstanceBuilder builder;
+      builder.Reserve(instance.size() + 1);
+      for (const auto& element : instance.elements()) {
+        builder.EmplaceElement(std::string(element.id()),
+                               static_cast<int64_t>(element.size()));
+      }
+      builder.EmplaceElement("odd", 1);
+      auto odd = builder.Build();
+      partition::PartitionSolver solver;
+      harness.Run("min_difference/dp/n=1001,max=5000", [&] {
+        partition::DoNotOptimize(solver.SolveMinimumDifference(odd).difference);
+      }, static_cast<double>(odd.size()), "elements");
+      auto heavy = GeneratePartition(100, uint64_t{1} << 40, 29);
+      for (double epsilon : {0.1, 0.01}) {
+        partition::PartitionApproximator approximator(epsilon);
+        char name[96];
+        std::snprintf(name, sizeof(name),
+                      "min_difference/fptas/n=200,max=2^40,epsilon=%g",
+                      epsilon);
+        harness.Run(name, [&] {
+          partition::DoNotOptimize(
+              approximator.SolveMinimumDifference(heavy).difference);
+        }, static_cast<double>(heavy.size()), "elements");
+      }
+
+      // Local search against its budget, on distinct sizes whose
+      // Karmarkar-Karp split is far from perfect, and through the kAuto
+      // fallback. The achieved differences are listed after the report.
+      std::mt19937_64 rng(31);
+      partition::PartitionInstanceBuilder wide_builder;
+      wide_builder.Reserve(100);
+      char id[32];
+      for (size_t i = 0; i < 100; ++i) {
+        std::snprintf(id, sizeof(id), "e%zu", i);
+        wide_builder.EmplaceElement(
+            id, static_cast<int64_t>(rng() % (uint64_t{1} << 40) + 1));
+      }
+      auto wide = wide_builder.Build();
+      for (double budget : {1.0, 10.0, 100.0}) {
+        partition::LocalSearchOptions options;
+        options.time_budget_ms = budget;
+        partition::LocalSearchSolver local(options);
+        char name[96];
+        std::snprintf(name, sizeof(name),
+                      "min_difference/local/n=100,max=2^40,budget=%gms",
+                      budget);
+        harness.Run(name, [&] {
+          differences[name] = local.SolveMinimumDifference(wide).difference;
+        }, static_cast<double>(wide.size()), "elements");
+      }
+      partition::PartitionSolver auto_solver(
+          partition::PartitionSolver::Algorithm::kAuto);
+      auto_solver.SetLocalSearchBudget(10);
+      std::string auto_name =
+          "min_difference/auto/n=100,max=2^40,budget=10ms";
+      harness.Run(auto_name, [&] {
+        differences[auto_name] =
+            auto_solver.SolveMinimumDifference(wide).difference;
+      }, static_cast<double>(wide.size()), "elements");
+    }
+
+    // Counting: the counting DP against walking every split, and DLX over
+    // the components of a block 3DM instance.
+    {
+      auto instance = GeneratePartition(12, 50, 37);
+      partition::PartitionCounter counter;
+      harness.Run("count/partition/dp/n=24,max=50", [&] {
+        partition::DoNotOptimize(counter.Count(instance).IsZero());
+      }, static_cast<double>(instance.size()), "elements");
+      harness.Run("count/partition/enumerate/n=24,max=50", [&] {
+        size_t splits = 0;
+        for (const auto& split : counter.Enumerate(instance)) {
+          splits += split.size();
+        }
+        partition::DoNotOptimize(splits);
+      }, static_cast<double>(instance.size()), "elements");
+      auto text = GenerateBlockThreeDMText(40, 6, 18, 41);
+      partition::MemoryInputStream input(text);
+      auto three_dm = partition::ThreeDMReader().ReadFromStream(input);
+      partition::MatchingCounter matching_counter;
+      harness.Run("count/3dm/blocks=40,q=6,k=18", [&] {
+        partition::DoNotOptimize(matching_counter.Count(three_dm).IsZero());
+      }, static_cast<double>(three_dm.triples().size()), "triples");
+    }
+
+    // 3DM by components: 40 blocks of q=6, k=18. Whole-instance exact cover
+    // against one small reduction per block.
+    {
+      auto text = GenerateBlockThreeDMText(40, 6, 18, 17);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      partition::ThreeDMToPartitionReducer whole_reducer;
+      partition::ReducedPartitionSolver whole_solver;
+      harness.Run("solve_3dm/whole/blocks=40,q=6,k=18", [&] {
+        auto reduced = whole_reducer.ReduceCompact(instance);
+        partition::DoNotOptimize(whole_solver.Solve(reduced).has_value());
+      }, static_cast<double>(instance.triples().size()), "triples");
+      partition::ComponentSolver component_solver;
+      harness.Run("solve_3dm/components/blocks=40,q=6,k=18", [&] {
+        partition::DoNotOptimize(component_solver.Solve(instance).has_value());
+      }, static_cast<double>(instance.triples().size()), "triples");
+    }
+
+    // -------------- VERIFIER --------------
+    {
+      auto instance = GeneratePartition(50000, 1000000, 11);
+      auto subset = EvenHalf(instance);
+      harness.Run("verify/partition/n=100000", [&] {
+        bool valid = partition::SolutionVerifier::VerifyPartitionSolution(instance, subset);
+        partition::DoNotOptimize(valid);
+      }, static_cast<double>(instance.size()), "elements");
+      partition::PartitionBitmapVerifier verifier(instance);
+      auto bitmap = *verifier.ToBitmap(subset);
+      harness.Run("verify/partition_bitmap/n=100000", [&] {
+        partition::DoNotOptimize(verifier.Verify(bitmap));
+      }, static_cast<double>(instance.size()), "elements");
+      std::vector<partition::SubsetBitmap> candidates(256, bitmap);
+      harness.Run("verify_batch/partition_bitmap/n=100000,candidates=256", [&] {
+        partition::DoNotOptimize(verifier.VerifyBatch(candidates).size());
+      }, static_cast<double>(instance.size() * candidates.size()), "elements");
+    }
+    {
+      size_t q = 10000;
+      auto text = GenerateThreeDMText(q, 3 * q, 13);
+      partition::MemoryInputStream input(text);
+      auto instance = partition::ThreeDMReader().ReadFromStream(input);
+      std::vector<partition::Triple> matching(instance.triples().begin(),
+                                              instance.triples().begin() + q);
+      harness.Run("verify/3dm/q=10000", [&] {
+        bool valid = partition::SolutionVerifier::Verify3DMSolution(instance, matching);
+        partition::DoNotOptimize(valid);
+      }, static_cast<double>(q), "triples");
+      partition::ThreeDMBitmapVerifier verifier(instance);
+      auto indices = *verifier.ToIndices(matching);
+      harness.Run("verify/3dm_indices/q=10000", [&] {
+        partition::DoNotOptimize(verifier.Verify(indices));
+      }, static_cast<double>(q), "triples");
+    }
+
+    std::cout << harness.GenerateReport();
+    if (!differences.empty()) {
+      std::cout << std::endl << "=== MINIMUM DIFFERENCES ===" << std::endl;
+      for (const auto& [name, difference] : differences) {
+        std::cout << name << ": " << difference << std::endl;
+      }
+    }
+    if (!output_file.empty()) {
+      std::ofstream out(output_file);
+      if (!out) {
+        throw std::runtime_error("Could not open file: " + output_file);
+      }
+      out << harness.ToJsonLines();
+    }
+    if (!baseline_file.empty()) {
+      std::string comparison;
+      auto regressions = harness.CompareWithBaseline(
+          partition::BenchmarkHarness::LoadBaseline(baseline_file),
+          tolerance_percent / 100.0, comparison);
+      std::cout << std::endl << "=== BASELINE COMPARISON ===" << std::endl << comparison;
+      if (regressions > 0) {
+        std::cout << regressions << " benchmark(s) slower than the baseline" << std::endl;
+        return 1;
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
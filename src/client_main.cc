@@ -0,0 +1,104 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Sends instances to the reduction server and prints the responses.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "server/frame_io.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== 3DM TO PARTITION CLIENT ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " [options] <file>..." << std::endl << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "  -s <path>   Socket path (default: /tmp/partition.sock)" << std::endl;
+  std::cout << "  -b          Files are 3DM instances in the binary format" << std::endl;
+  std::cout << "  -p          Files are Partition instances" << std::endl;
+  std::cout << "  -h, --help  Show this help message" << std::endl << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  std::string socket_path = "/tmp/partition.sock";
+  auto type = partition::FrameType::kThreeDMText;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((std::strcmp(argv[i], "-h") == 0) || (std::strcmp(argv[i], "--help") == 0)) {
+      PrintHelp(argv[0]);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      socket_path = argv[++i];
+    } else if (std::strcmp(argv[i], "-b") == 0) {
+      type = partition::FrameType::kThreeDMBinary;
+    } else if (std::strcmp(argv[i], "-p") == 0) {
+      type = partition::FrameType::kPartitionText;
+    } else {
+      inputs.emplace_back(argv[i]);
+    }
+  }
+  if (inputs.empty()) {
+    PrintHelp(argv[0]);
+    return 1;
+  }
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path)) {
+    std::cerr << "Socket path too long: " << socket_path << std::endl;
+    return 1;
+  }
+  std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+    std::cerr << "Cannot connect to " << socket_path << ": " << std::strerror(errno) << std::endl;
+    return 1;
+  }
+
+  int exit_code = 0;
+  try {
+    for (const auto& input : inputs) {
+      std::ifstream file(input, std::ios::binary);
+      if (!file) {
+        std::cerr << input << ": cannot open file" << std::endl;
+        exit_code = 1;
+        continue;
+      }
+      std::ostringstream contents;
+      contents << file.rdbuf();
+      partition::WriteFrame(fd, type, contents.str());
+      partition::Frame response;
+      if (!partition::ReadFrame(fd, response)) {
+        throw std::runtime_error("server closed the connection");
+      }
+      std::cout << "=== " << input << " ===" << std::endl;
+      std::cout << response.payload;
+      if (response.type != partition::FrameType::kOk) {
+        exit_code = 1;
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    exit_code = 1;
+  }
+  ::close(fd);
+  return exit_code;
+}
@@ -13,11 +13,15 @@
 
 namespace partition {
 
-PartitionElement::PartitionElement(const std::string& id, uint64_t size)
-    : id_(id), size_(size) {}
+PartitionElement::PartitionElement(std::string_view id, uint64_t size,
+                                   const allocator_type& alloc)
+    : id_(id, alloc), size_(size) {}
 
 auto PartitionElement::ToString() const -> std::string {
-  return id_ + " " + std::to_string(size_);
+  std::string result(id_);
+  result += " ";
+  result += std::to_string(size_);
+  return result;
 }
 
 }  // namespace partition
\ No newline at end of file
@@ -10,23 +10,51 @@
  */
 
 #include "core/partition_instance.h"
+#include "util/memory_accounting.h"
+
+#include <utility>
 
 namespace partition {
-  
+
+  PartitionInstance::PartitionInstance(ElementList&& elements,
+                                       int64_t total_sum,
+                                       size_t binary_display_width)
+      : elements_(std::move(elements)),
+        total_sum_(total_sum),
+        binary_display_width_(binary_display_width) {}
+
   auto PartitionInstance::AddElement(const PartitionElement& element) -> void {
     elements_.push_back(element);
-    RecalculateTotalSum();
+    total_sum_ += element.size();
   }
-  
-  auto PartitionInstance::SetElements(const std::vector<PartitionElement>& elements) -> void {
+
+  auto PartitionInstance::AddElement(PartitionElement&& element) -> void {
+    total_sum_ += element.size();
+    elements_.push_back(std::move(element));
+  }
+
+  auto PartitionInstance::SetElements(const ElementList& elements) -> void {
     elements_ = elements;
     RecalculateTotalSum();
   }
 
+  auto PartitionInstance::SetElements(ElementList&& elements) -> void {
+    elements_ = std::move(elements);
+    RecalculateTotalSum();
+  }
+
   auto PartitionInstance::IsValid() const -> bool {
     return !elements_.empty();
   }
 
+  auto PartitionInstance::MemoryFootprint() const -> size_t {
+    size_t bytes = elements_.capacity() * sizeof(PartitionElement);
+    for (const auto& element : elements_) {
+      bytes += StringHeapBytes(element.id().size());
+    }
+    return bytes;
+  }
+
   auto PartitionInstance::ToString() const -> std::string {
     std::ostringstream oss;
     oss << "Partition Instance:\n";
@@ -0,0 +1,37 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionInstanceBuilder.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/partition_instance_builder.h"
+
+namespace partition {
+
+auto PartitionInstanceBuilder::AddElement(const PartitionElement& element)
+    -> void {
+  elements_.push_back(element);
+  total_sum_ += element.size();
+}
+
+auto PartitionInstanceBuilder::AddElement(PartitionElement&& element) -> void {
+  total_sum_ += element.size();
+  elements_.push_back(std::move(element));
+}
+
+auto PartitionInstanceBuilder::Build() -> PartitionInstance {
+  auto* memory = resource();
+  PartitionInstance instance(std::move(elements_), total_sum_,
+                             binary_display_width_);
+  elements_ = PartitionInstance::ElementList(memory);
+  total_sum_ = 0;
+  binary_display_width_ = 0;
+  return instance;
+}
+
+}  // namespace partition
@@ -0,0 +1,215 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ReducedPartitionInstance.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/reduced_partition_instance.h"
+#include "core/partition_instance_builder.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Packs one p-bit field per slot into a wide integer.
+ * Each value must be below 2^p, so the fields never overlap.
+ */
+template <typename ValueAt>
+auto PackFields(size_t slots, size_t p, ValueAt value_at) -> WideUnsigned {
+  std::vector<uint64_t> limbs((slots * p + 63) / 64 + 1, 0);
+  for (size_t slot = 0; slot < slots; ++slot) {
+    uint64_t value = value_at(slot);
+    size_t offset = slot * p;
+    limbs[offset / 64] |= value << (offset % 64);
+    if (offset % 64 != 0 && offset % 64 + p > 64) {
+      limbs[offset / 64 + 1] |= value >> (64 - offset % 64);
+    }
+  }
+  return WideUnsigned::FromLimbs(std::move(limbs));
+}
+
+}  // namespace
+
+ReducedPartitionInstance::ReducedPartitionInstance(size_t q, size_t p,
+                                                   const allocator_type& alloc)
+    : q_(q),
+      p_(p),
+      narrow_(3 * q * p <= std::numeric_limits<uint16_t>::max()),
+      narrow_positions_(alloc),
+      wide_positions_(alloc),
+      slot_counts_(3 * q, 0, alloc) {}
+
+auto ReducedPartitionInstance::Reserve(size_t k) -> void {
+  if (narrow_) {
+    narrow_positions_.reserve(3 * k);
+  } else {
+    wide_positions_.reserve(3 * k);
+  }
+}
+
+auto ReducedPartitionInstance::AddTriplePositions(const Positions& positions)
+    -> void {
+  for (uint32_t position : positions) {
+    if (narrow_) {
+      narrow_positions_.push_back(static_cast<uint16_t>(position));
+    } else {
+      wide_positions_.push_back(position);
+    }
+    ++slot_counts_[position / p_];
+  }
+  position_count_ += 3;
+}
+
+auto ReducedPartitionInstance::positions(size_t i) const -> Positions {
+  if (narrow_) {
+    return {narrow_positions_[3 * i], narrow_positions_[3 * i + 1],
+            narrow_positions_[3 * i + 2]};
+  }
+  return {wide_positions_[3 * i], wide_positions_[3 * i + 1],
+          wide_positions_[3 * i + 2]};
+}
+
+auto ReducedPartitionInstance::ElementId(size_t index) const -> std::string {
+  auto k = triple_count();
+  if (index < k) {
+    return "a_" + std::to_string(index);
+  }
+  return index == k ? "b1" : "b2";
+}
+
+auto ReducedPartitionInstance::IndexOf(std::string_view id) const
+    -> std::optional<size_t> {
+  auto k = triple_count();
+  if (id == "b1") {
+    return k;
+  }
+  if (id == "b2") {
+    return k + 1;
+  }
+  if (id.size() < 3 || id.substr(0, 2) != "a_") {
+    return std::nullopt;
+  }
+  size_t index = 0;
+  auto digits = id.substr(2);
+  auto [end, error] =
+      std::from_chars(digits.data(), digits.data() + digits.size(), index);
+  if (error != std::errc() || end != digits.data() + digits.size() ||
+      index >= k || std::to_string(index) != digits) {
+    return std::nullopt;
+  }
+  return index;
+}
+
+auto ReducedPartitionInstance::ElementSize(size_t index) const
+    -> WideUnsigned {
+  auto k = triple_count();
+  if (index < k) {
+    WideUnsigned size;
+    for (uint32_t position : positions(index)) {
+      size.AddPow2(position);
+    }
+    return size;
+  }
+  auto total = TripleTotal();
+  if (index == k) {
+    if (FillerUnderflows()) {
+      throw std::underflow_error(
+          "b1 would be negative: the triples do not cover W, X and Y");
+    }
+    total <<= 1;
+    return total - FieldBase();
+  }
+  return total + FieldBase();
+}
+
+auto ReducedPartitionInstance::FillerUnderflows() const -> bool {
+  auto doubled = TripleTotal();
+  doubled <<= 1;
+  return doubled < FieldBase();
+}
+
+auto ReducedPartitionInstance::HasUncoveredSlot() const -> bool {
+  return std::find(slot_counts_.begin(), slot_counts_.end(), 0u) !=
+         slot_counts_.end();
+}
+
+auto ReducedPartitionInstance::TripleTotal() const -> WideUnsigned {
+  return PackFields(3 * q_, p_,
+                    [this](size_t slot) { return slot_counts_[slot]; });
+}
+
+auto ReducedPartitionInstance::FieldBase() const -> WideUnsigned {
+  return PackFields(3 * q_, p_, [](size_t) { return uint64_t{1}; });
+}
+
+auto ReducedPartitionInstance::TotalSum() const -> WideUnsigned {
+  auto total = TripleTotal();
+  total <<= 2;
+  return total;
+}
+
+auto ReducedPartitionInstance::FitsInPartitionInstance() const -> bool {
+  return TotalSum().BitWidth() <= 63;
+}
+
+auto ReducedPartitionInstance::ToPartitionInstance() const
+    -> PartitionInstance {
+  if (!FitsInPartitionInstance()) {
+    throw std::overflow_error(
+        "Reduced instance needs " + std::to_string(TotalSum().BitWidth()) +
+        " bits and does not fit in a PartitionInstance");
+  }
+  PartitionInstanceBuilder builder(slot_counts_.get_allocator().resource());
+  builder.Reserve(size());
+  for (size_t i = 0; i < size(); ++i) {
+    builder.EmplaceElement(ElementId(i), ElementSize(i).ToUint64());
+  }
+  builder.SetBinaryDisplayWidth(bit_width());
+  return builder.Build();
+}
+
+auto ReducedPartitionInstance::MemoryFootprint() const -> size_t {
+  return narrow_positions_.capacity() * sizeof(uint16_t) +
+         wide_positions_.capacity() * sizeof(uint32_t) +
+         slot_counts_.capacity() * sizeof(uint32_t);
+}
+
+auto ReducedPartitionInstance::EstimateFootprint(size_t q, size_t k)
+    -> size_t {
+  size_t p = std::bit_width(k);
+  size_t position_bytes = 3 * q * p <= std::numeric_limits<uint16_t>::max()
+                              ? sizeof(uint16_t)
+                              : sizeof(uint32_t);
+  return 3 * k * position_bytes + 3 * q * sizeof(uint32_t);
+}
+
+auto ReducedPartitionInstance::ToString() const -> std::string {
+  std::ostringstream oss;
+  auto total = TotalSum();
+  oss << "Partition Instance:\n";
+  oss << size() << " elements.\n";
+  oss << "Total sum: " << total.ToDecimalString()
+      << " (binary: " << total.ToBinaryString(bit_width()) << ")\n";
+  oss << "Elements:\n";
+  for (size_t i = 0; i < size(); ++i) {
+    auto element_size = ElementSize(i);
+    oss << "  " << ElementId(i) << " " << element_size.ToDecimalString()
+        << " (binary: " << element_size.ToBinaryString(bit_width()) << ")\n";
+  }
+  return oss.str();
+}
+
+}  // namespace partition
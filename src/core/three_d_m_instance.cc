@@ -10,38 +10,101 @@
  */
 
 #include "core/three_d_m_instance.h"
-#include <iostream>
+#include "util/memory_accounting.h"
+#include <utility>
 
 namespace partition {
 
+namespace {
+
+/// Bytes of one std::set node holding an element name (libstdc++ keeps a
+/// color and three pointers in front of the value).
+constexpr size_t kSetNodeBytes = 4 * sizeof(void*) + sizeof(std::pmr::string);
+
+auto SetFootprint(const ThreeDMInstance::ElementSet& elements) -> size_t {
+  size_t bytes = elements.size() * kSetNodeBytes;
+  for (const auto& element : elements) {
+    bytes += StringHeapBytes(element.capacity());
+  }
+  return bytes;
+}
+
+}  // namespace
+
+  ThreeDMInstance::ThreeDMInstance(ElementSet&& w, ElementSet&& x,
+                                   ElementSet&& y, TripleList&& m, size_t q)
+      : w_(std::move(w)),
+        x_(std::move(x)),
+        y_(std::move(y)),
+        m_(std::move(m)),
+        q_(q) {}
+
   auto ThreeDMInstance::SetQ(size_t q) -> void {
     q_ = q;
   }
   
-  auto ThreeDMInstance::SetW(const std::set<std::string>& w) -> void {
+  auto ThreeDMInstance::SetW(const ElementSet& w) -> void {
     w_ = w;
   }
 
-  auto ThreeDMInstance::SetX(const std::set<std::string>& x) -> void {
+  auto ThreeDMInstance::SetW(ElementSet&& w) -> void {
+    w_ = std::move(w);
+  }
+
+  auto ThreeDMInstance::SetX(const ElementSet& x) -> void {
     x_ = x;
   }
 
-  auto ThreeDMInstance::SetY(const std::set<std::string>& y) -> void {
+  auto ThreeDMInstance::SetX(ElementSet&& x) -> void {
+    x_ = std::move(x);
+  }
+
+  auto ThreeDMInstance::SetY(const ElementSet& y) -> void {
     y_ = y;
   }
 
+  auto ThreeDMInstance::SetY(ElementSet&& y) -> void {
+    y_ = std::move(y);
+  }
+
   auto ThreeDMInstance::AddTriple(const Triple& triple) -> void {
     m_.push_back(triple);
   }
 
-  auto ThreeDMInstance::SetTriples(const std::vector<Triple>& triples) -> void {
+  auto ThreeDMInstance::AddTriple(Triple&& triple) -> void {
+    m_.push_back(std::move(triple));
+  }
+
+  auto ThreeDMInstance::SetTriples(const TripleList& triples) -> void {
     m_ = triples;
   }
 
+  auto ThreeDMInstance::SetTriples(TripleList&& triples) -> void {
+    m_ = std::move(triples);
+  }
+
   auto ThreeDMInstance::IsValid() const -> bool {
     return w_.size() == q_ && x_.size() == q_ && y_.size() == q_;
   }
 
+  auto ThreeDMInstance::MemoryFootprint() const -> size_t {
+    size_t bytes = SetFootprint(w_) + SetFootprint(x_) + SetFootprint(y_) +
+                   m_.capacity() * sizeof(Triple);
+    for (const auto& triple : m_) {
+      bytes += StringHeapBytes(triple.w().size()) +
+               StringHeapBytes(triple.x().size()) +
+               StringHeapBytes(triple.y().size());
+    }
+    return bytes;
+  }
+
+  auto ThreeDMInstance::EstimateFootprint(const ThreeDMShape& shape)
+      -> size_t {
+    size_t name_bytes = StringHeapBytes(shape.name_length);
+    return 3 * shape.q * (kSetNodeBytes + name_bytes) +
+           shape.k * (sizeof(Triple) + 3 * name_bytes);
+  }
+
   auto ThreeDMInstance::ToString() const -> std::string {
     std::string instance_info{""};
     for (const auto& w_i: w_) {
@@ -56,7 +119,6 @@ namespace partition {
       instance_info += y_i + " ";
     }
     instance_info += "\n";
-    std::cout << "M size: " << m_.size() << "\n";
     for (std::size_t i{0}; i < m_.size(); ++i) {
       instance_info += m_[i].ToString() + "\n";
     }
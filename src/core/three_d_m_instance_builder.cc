@@ -0,0 +1,28 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ThreeDMInstanceBuilder.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/three_d_m_instance_builder.h"
+
+namespace partition {
+
+auto ThreeDMInstanceBuilder::Build() -> ThreeDMInstance {
+  auto* memory = resource();
+  ThreeDMInstance instance(std::move(w_), std::move(x_), std::move(y_),
+                           std::move(m_), q_);
+  w_ = ElementSet(memory);
+  x_ = ElementSet(memory);
+  y_ = ElementSet(memory);
+  m_ = ThreeDMInstance::TripleList(memory);
+  q_ = 0;
+  return instance;
+}
+
+}  // namespace partition
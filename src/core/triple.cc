@@ -25,6 +25,10 @@ namespace partition {
   }
 
   auto Triple::ToString() const -> std::string {
-    return "(" + w_ + ", " + x_ + ", " + y_ + ")";
+    std::string result;
+    result.reserve(w_.size() + x_.size() + y_.size() + 6);
+    result.append("(").append(w_).append(", ").append(x_).append(", ");
+    result.append(y_).append(")");
+    return result;
   }
 }
\ No newline at end of file
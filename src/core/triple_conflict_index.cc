@@ -0,0 +1,186 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for TripleConflictIndex.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/triple_conflict_index.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace partition {
+
+namespace {
+
+/// One name map node: next pointer, key, value and the cached hash.
+constexpr size_t kNameNodeBytes =
+    sizeof(void*) + sizeof(std::pair<const std::string_view, uint32_t>) +
+    sizeof(size_t);
+
+}  // namespace
+
+TripleConflictIndex::TripleConflictIndex(const ThreeDMInstance& instance,
+                                         size_t threads,
+                                         size_t max_bitset_triples)
+    : set_sizes_{instance.w().size(), instance.x().size(),
+                 instance.y().size()} {
+  const ThreeDMInstance::ElementSet* sets[3] = {&instance.w(), &instance.x(),
+                                                &instance.y()};
+  uint32_t next_id = 0;
+  for (size_t set = 0; set < 3; ++set) {
+    names_[set].reserve(sets[set]->size());
+    for (const auto& name : *sets[set]) {
+      names_[set].emplace(name, next_id++);
+    }
+  }
+
+  // Resolve names and count the triples of each element.
+  const auto& triples = instance.triples();
+  size_t k = triples.size();
+  coordinates_.resize(k);
+  std::vector<std::atomic<uint32_t>> counts(next_id);
+  std::atomic<bool> unknown{false};
+  ParallelFor(k, threads, [&](size_t begin, size_t end) {
+    for (size_t t = begin; t < end; ++t) {
+      std::string_view names[3] = {triples[t].w(), triples[t].x(),
+                                   triples[t].y()};
+      for (size_t set = 0; set < 3; ++set) {
+        auto it = names_[set].find(names[set]);
+        if (it == names_[set].end()) {
+          unknown.store(true, std::memory_order_relaxed);
+          return;
+        }
+        coordinates_[t][set] = it->second;
+        counts[it->second].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  });
+  if (unknown.load()) {
+    throw std::out_of_range(
+        "A triple names an element that is not in W, X or Y");
+  }
+
+  // Lay the posting lists out back to back and fill them; each list is
+  // sorted afterwards, since threads append to it in any order.
+  offsets_.assign(next_id + 1, 0);
+  for (uint32_t element = 0; element < next_id; ++element) {
+    offsets_[element + 1] = offsets_[element] + counts[element].load();
+    counts[element].store(offsets_[element], std::memory_order_relaxed);
+  }
+  postings_.resize(3 * k);
+  ParallelFor(k, threads, [&](size_t begin, size_t end) {
+    for (size_t t = begin; t < end; ++t) {
+      for (uint32_t element : coordinates_[t]) {
+        postings_[counts[element].fetch_add(1, std::memory_order_relaxed)] =
+            static_cast<uint32_t>(t);
+      }
+    }
+  });
+  ParallelFor(next_id, threads, [&](size_t begin, size_t end) {
+    for (size_t element = begin; element < end; ++element) {
+      std::sort(postings_.begin() + offsets_[element],
+                postings_.begin() + offsets_[element + 1]);
+    }
+  });
+
+  // Each thread writes only the rows of its own triples.
+  words_ = (k + 63) / 64;
+  if (k <= max_bitset_triples) {
+    bits_.assign(k * words_, 0);
+    ParallelFor(k, threads, [&](size_t begin, size_t end) {
+      for (size_t t = begin; t < end; ++t) {
+        uint64_t* row = bits_.data() + t * words_;
+        for (uint32_t element : coordinates_[t]) {
+          for (uint32_t other : TriplesWith(element)) {
+            row[other / 64] |= uint64_t{1} << (other % 64);
+          }
+        }
+        row[t / 64] &= ~(uint64_t{1} << (t % 64));
+      }
+    });
+  }
+}
+
+auto TripleConflictIndex::ElementId(size_t set, std::string_view name) const
+    -> std::optional<uint32_t> {
+  auto it = names_[set].find(name);
+  if (it == names_[set].end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+auto TripleConflictIndex::FindTriple(const Coordinates& coordinates) const
+    -> std::optional<uint32_t> {
+  // Scan the shortest of the three posting lists.
+  auto shortest = TriplesWith(coordinates[0]);
+  for (size_t set = 1; set < 3; ++set) {
+    auto list = TriplesWith(coordinates[set]);
+    if (list.size() < shortest.size()) {
+      shortest = list;
+    }
+  }
+  for (uint32_t triple : shortest) {
+    if (coordinates_[triple] == coordinates) {
+      return triple;
+    }
+  }
+  return std::nullopt;
+}
+
+auto TripleConflictIndex::Conflicts(size_t a, size_t b) const -> bool {
+  if (a == b) {
+    return false;
+  }
+  if (has_bitsets()) {
+    return (bits_[a * words_ + b / 64] >> (b % 64)) & 1;
+  }
+  const auto& first = coordinates_[a];
+  const auto& second = coordinates_[b];
+  return first[0] == second[0] || first[1] == second[1] ||
+         first[2] == second[2];
+}
+
+auto TripleConflictIndex::ConflictsWith(size_t triple,
+                                        const Bitmap& selected) const
+    -> bool {
+  if (has_bitsets()) {
+    const uint64_t* row = bits_.data() + triple * words_;
+    uint64_t any = 0;
+    for (size_t w = 0; w < words_; ++w) {
+      any |= row[w] & selected[w];
+    }
+    return any != 0;
+  }
+  for (uint32_t element : coordinates_[triple]) {
+    for (uint32_t other : TriplesWith(element)) {
+      if (other != triple && ((selected[other / 64] >> (other % 64)) & 1)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+auto TripleConflictIndex::MemoryFootprint() const -> size_t {
+  size_t bytes = coordinates_.capacity() * sizeof(Coordinates) +
+                 offsets_.capacity() * sizeof(uint32_t) +
+                 postings_.capacity() * sizeof(uint32_t) +
+                 bits_.capacity() * sizeof(uint64_t);
+  for (const auto& names : names_) {
+    bytes += names.bucket_count() * sizeof(void*) +
+             names.size() * kNameNodeBytes;
+  }
+  return bytes;
+}
+
+}  // namespace partition
@@ -0,0 +1,213 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for WideUnsigned.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "core/wide_unsigned.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace partition {
+
+WideUnsigned::WideUnsigned(uint64_t value) {
+  if (value != 0) {
+    limbs_.push_back(value);
+  }
+}
+
+auto WideUnsigned::Pow2(size_t exponent) -> WideUnsigned {
+  WideUnsigned result;
+  result.AddPow2(exponent);
+  return result;
+}
+
+auto WideUnsigned::FromLimbs(std::vector<uint64_t> limbs) -> WideUnsigned {
+  WideUnsigned result;
+  result.limbs_ = std::move(limbs);
+  result.Normalize();
+  return result;
+}
+
+auto WideUnsigned::AddPow2(size_t exponent) -> void {
+  size_t limb = exponent / 64;
+  if (limbs_.size() <= limb) {
+    limbs_.resize(limb + 1, 0);
+  }
+  uint64_t addend = uint64_t{1} << (exponent % 64);
+  while (addend != 0) {
+    if (limb == limbs_.size()) {
+      limbs_.push_back(0);
+    }
+    limbs_[limb] += addend;
+    addend = limbs_[limb] < addend ? 1 : 0;
+    ++limb;
+  }
+}
+
+auto WideUnsigned::operator+=(const WideUnsigned& other) -> WideUnsigned& {
+  if (limbs_.size() < other.limbs_.size()) {
+    limbs_.resize(other.limbs_.size(), 0);
+  }
+  uint64_t carry = 0;
+  for (size_t i = 0; i < limbs_.size(); ++i) {
+    uint64_t addend = i < other.limbs_.size() ? other.limbs_[i] : 0;
+    if (addend == 0 && carry == 0 && i >= other.limbs_.size()) {
+      break;
+    }
+    uint64_t sum = limbs_[i] + addend;
+    uint64_t next_carry = sum < addend ? 1 : 0;
+    limbs_[i] = sum + carry;
+    next_carry |= limbs_[i] < carry ? 1 : 0;
+    carry = next_carry;
+  }
+  if (carry != 0) {
+    limbs_.push_back(carry);
+  }
+  return *this;
+}
+
+auto WideUnsigned::operator-=(const WideUnsigned& other) -> WideUnsigned& {
+  if (*this < other) {
+    throw std::underflow_error("WideUnsigned subtraction would be negative");
+  }
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < limbs_.size(); ++i) {
+    uint64_t subtrahend = i < other.limbs_.size() ? other.limbs_[i] : 0;
+    if (subtrahend == 0 && borrow == 0 && i >= other.limbs_.size()) {
+      break;
+    }
+    uint64_t before = limbs_[i];
+    limbs_[i] = before - subtrahend - borrow;
+    borrow = (before < subtrahend || (before - subtrahend) < borrow) ? 1 : 0;
+  }
+  Normalize();
+  return *this;
+}
+
+auto WideUnsigned::operator*=(uint64_t factor) -> WideUnsigned& {
+  __extension__ typedef unsigned __int128 Wide;
+  if (factor == 0) {
+    limbs_.clear();
+    return *this;
+  }
+  uint64_t carry = 0;
+  for (uint64_t& limb : limbs_) {
+    Wide product = static_cast<Wide>(limb) * factor + carry;
+    limb = static_cast<uint64_t>(product);
+    carry = static_cast<uint64_t>(product >> 64);
+  }
+  if (carry != 0) {
+    limbs_.push_back(carry);
+  }
+  return *this;
+}
+
+auto WideUnsigned::operator<<=(size_t bits) -> WideUnsigned& {
+  if (limbs_.empty() || bits == 0) {
+    return *this;
+  }
+  size_t limb_shift = bits / 64;
+  size_t bit_shift = bits % 64;
+  std::vector<uint64_t> shifted(limbs_.size() + limb_shift + 1, 0);
+  for (size_t i = 0; i < limbs_.size(); ++i) {
+    shifted[i + limb_shift] |= limbs_[i] << bit_shift;
+    if (bit_shift != 0) {
+      shifted[i + limb_shift + 1] |= limbs_[i] >> (64 - bit_shift);
+    }
+  }
+  limbs_ = std::move(shifted);
+  Normalize();
+  return *this;
+}
+
+auto WideUnsigned::operator<=>(const WideUnsigned& other) const
+    -> std::strong_ordering {
+  if (limbs_.size() != other.limbs_.size()) {
+    return limbs_.size() <=> other.limbs_.size();
+  }
+  for (size_t i = limbs_.size(); i-- > 0;) {
+    if (limbs_[i] != other.limbs_[i]) {
+      return limbs_[i] <=> other.limbs_[i];
+    }
+  }
+  return std::strong_ordering::equal;
+}
+
+auto WideUnsigned::BitWidth() const -> size_t {
+  if (limbs_.empty()) {
+    return 0;
+  }
+  return (limbs_.size() - 1) * 64 + std::bit_width(limbs_.back());
+}
+
+auto WideUnsigned::ToUint64() const -> uint64_t {
+  if (!FitsInUint64()) {
+    throw std::overflow_error("Value does not fit in 64 bits");
+  }
+  return limbs_.empty() ? 0 : limbs_[0];
+}
+
+auto WideUnsigned::ToDecimalString() const -> std::string {
+  if (limbs_.empty()) {
+    return "0";
+  }
+  // Repeated division by 10^9 on 32-bit halves keeps every intermediate
+  // value below 2^62.
+  constexpr uint64_t kChunk = 1000000000;
+  std::vector<uint32_t> halves;
+  halves.reserve(limbs_.size() * 2);
+  for (uint64_t limb : limbs_) {
+    halves.push_back(static_cast<uint32_t>(limb));
+    halves.push_back(static_cast<uint32_t>(limb >> 32));
+  }
+  while (!halves.empty() && halves.back() == 0) {
+    halves.pop_back();
+  }
+  std::vector<uint32_t> chunks;
+  while (!halves.empty()) {
+    uint64_t remainder = 0;
+    for (size_t i = halves.size(); i-- > 0;) {
+      uint64_t current = (remainder << 32) | halves[i];
+      halves[i] = static_cast<uint32_t>(current / kChunk);
+      remainder = current % kChunk;
+    }
+    chunks.push_back(static_cast<uint32_t>(remainder));
+    while (!halves.empty() && halves.back() == 0) {
+      halves.pop_back();
+    }
+  }
+  std::string result = std::to_string(chunks.back());
+  for (size_t i = chunks.size() - 1; i-- > 0;) {
+    std::string chunk = std::to_string(chunks[i]);
+    result.append(9 - chunk.size(), '0');
+    result += chunk;
+  }
+  return result;
+}
+
+auto WideUnsigned::ToBinaryString(size_t min_width) const -> std::string {
+  size_t width = std::max<size_t>({BitWidth(), min_width, 1});
+  std::string binary(width, '0');
+  for (size_t bit = 0; bit < BitWidth(); ++bit) {
+    if ((limbs_[bit / 64] >> (bit % 64)) & 1) {
+      binary[width - 1 - bit] = '1';
+    }
+  }
+  return binary;
+}
+
+auto WideUnsigned::Normalize() -> void {
+  while (!limbs_.empty() && limbs_.back() == 0) {
+    limbs_.pop_back();
+  }
+}
+
+}  // namespace partition
@@ -0,0 +1,184 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Generates seeded synthetic 3DM and Partition instances.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "generators/partition_generator.h"
+#include "generators/three_d_m_generator.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== INSTANCE GENERATOR ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " 3dm [options]" << std::endl;
+  std::cout << "  " << programName << " partition [options]" << std::endl << std::endl;
+  std::cout << "Common options:" << std::endl;
+  std::cout << "  -s <seed>        Seed; the same seed always gives the same instance (default: 1)" << std::endl;
+  std::cout << "  -o <file>        Output file (default: stdout)" << std::endl;
+  std::cout << "  -A <file>        Write the planted answer to this file" << std::endl << std::endl;
+  std::cout << "3DM options:" << std::endl;
+  std::cout << "  -q <q>           Size of W, X and Y (default: 3)" << std::endl;
+  std::cout << "  -k <k>           Number of triples (default: 2q)" << std::endl;
+  std::cout << "  -d <degree>      uniform (default), zipf or regular" << std::endl;
+  std::cout << "  -z <exponent>    Zipf exponent (default: 1.0)" << std::endl;
+  std::cout << "  -a <answer>      planted (default), none or random" << std::endl;
+  std::cout << "  -b               Binary output" << std::endl << std::endl;
+  std::cout << "Partition options:" << std::endl;
+  std::cout << "  -n <n>           Number of elements (default: 10)" << std::endl;
+  std::cout << "  -m <min>         Smallest size (default: 1)" << std::endl;
+  std::cout << "  -M <max>         Largest size (default: 1000)" << std::endl;
+  std::cout << "  -d <sizes>       uniform (default), loguniform or clustered" << std::endl;
+  std::cout << "  -a <answer>      solvable (default), unsolvable or random" << std::endl << std::endl;
+  std::cout << "Example:" << std::endl;
+  std::cout << "  " << programName << " 3dm -q 1000 -k 100000 -d zipf -s 7 -o big.txt -A big.answer" << std::endl << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 2 || std::strcmp(argv[1], "-h") == 0 || std::strcmp(argv[1], "--help") == 0) {
+    PrintHelp(argv[0]);
+    return argc < 2 ? 1 : 0;
+  }
+  std::string kind = argv[1];
+  if (kind != "3dm" && kind != "partition") {
+    std::cerr << "Unknown instance type: " << kind << std::endl;
+    PrintHelp(argv[0]);
+    return 1;
+  }
+
+  partition::ThreeDMGeneratorOptions three_dm;
+  partition::PartitionGeneratorOptions partition_options;
+  bool k_given = false;
+  std::string output_file;
+  std::string answer_file;
+
+  try {
+    for (int i = 2; i < argc; ++i) {
+      std::string option = argv[i];
+      if (option == "-h" || option == "--help") {
+        PrintHelp(argv[0]);
+        return 0;
+      }
+      if (option == "-b") {
+        three_dm.format = partition::ThreeDMGeneratorOptions::Format::kBinary;
+        continue;
+      }
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << option << std::endl;
+        return 1;
+      }
+      std::string value = argv[++i];
+      if (option == "-s") {
+        three_dm.seed = partition_options.seed = std::stoull(value);
+      } else if (option == "-o") {
+        output_file = value;
+      } else if (option == "-A") {
+        answer_file = value;
+      } else if (option == "-q") {
+        three_dm.q = std::stoull(value);
+      } else if (option == "-k") {
+        three_dm.k = std::stoull(value);
+        k_given = true;
+      } else if (option == "-z") {
+        three_dm.zipf_exponent = std::stod(value);
+      } else if (option == "-n") {
+        partition_options.n = std::stoull(value);
+      } else if (option == "-m") {
+        partition_options.min_size = std::stoull(value);
+      } else if (option == "-M") {
+        partition_options.max_size = std::stoull(value);
+      } else if (option == "-d" && kind == "3dm") {
+        using Degree = partition::ThreeDMGeneratorOptions::Degree;
+        if (value == "uniform") {
+          three_dm.degree = Degree::kUniform;
+        } else if (value == "zipf") {
+          three_dm.degree = Degree::kZipf;
+        } else if (value == "regular") {
+          three_dm.degree = Degree::kRegular;
+        } else {
+          std::cerr << "Unknown degree distribution: " << value << std::endl;
+          return 1;
+        }
+      } else if (option == "-d") {
+        using Sizes = partition::PartitionGeneratorOptions::Sizes;
+        if (value == "uniform") {
+          partition_options.sizes = Sizes::kUniform;
+        } else if (value == "loguniform") {
+          partition_options.sizes = Sizes::kLogUniform;
+        } else if (value == "clustered") {
+          partition_options.sizes = Sizes::kClustered;
+        } else {
+          std::cerr << "Unknown size distribution: " << value << std::endl;
+          return 1;
+        }
+      } else if (option == "-a" && kind == "3dm") {
+        using Answer = partition::ThreeDMGeneratorOptions::Answer;
+        if (value == "planted") {
+          three_dm.answer = Answer::kPlanted;
+        } else if (value == "none") {
+          three_dm.answer = Answer::kNoMatching;
+        } else if (value == "random") {
+          three_dm.answer = Answer::kRandom;
+        } else {
+          std::cerr << "Unknown answer mode: " << value << std::endl;
+          return 1;
+        }
+      } else if (option == "-a") {
+        using Answer = partition::PartitionGeneratorOptions::Answer;
+        if (value == "solvable") {
+          partition_options.answer = Answer::kSolvable;
+        } else if (value == "unsolvable") {
+          partition_options.answer = Answer::kUnsolvable;
+        } else if (value == "random") {
+          partition_options.answer = Answer::kRandom;
+        } else {
+          std::cerr << "Unknown answer mode: " << value << std::endl;
+          return 1;
+        }
+      } else {
+        std::cerr << "Unknown option: " << option << std::endl;
+        return 1;
+      }
+    }
+    if (!k_given) {
+      three_dm.k = 2 * three_dm.q;
+    }
+
+    std::ofstream file;
+    if (!output_file.empty()) {
+      file.open(output_file, std::ios::binary);
+      if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + output_file);
+      }
+    }
+    std::ostream& output = output_file.empty() ? std::cout : file;
+    std::unique_ptr<std::ofstream> answer;
+    if (!answer_file.empty()) {
+      answer = std::make_unique<std::ofstream>(answer_file);
+      if (!answer->is_open()) {
+        throw std::runtime_error("Could not open file: " + answer_file);
+      }
+    }
+
+    if (kind == "3dm") {
+      partition::ThreeDMGenerator(three_dm).Generate(output, answer.get());
+    } else {
+      partition::PartitionGenerator(partition_options).Generate(output, answer.get());
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
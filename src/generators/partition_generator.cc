@@ -0,0 +1,139 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionGenerator.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "generators/partition_generator.h"
+#include "generators/random_source.h"
+#include "util/buffered_output.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+using Options = PartitionGeneratorOptions;
+
+/// Totals stay below this so sums of sizes never overflow int64_t.
+constexpr uint64_t kMaxTotal = uint64_t{1} << 62;
+
+auto DrawSize(const Options& options, RandomSource& random) -> uint64_t {
+  switch (options.sizes) {
+    case Options::Sizes::kLogUniform: {
+      double low = std::log(static_cast<double>(options.min_size));
+      double high = std::log(static_cast<double>(options.max_size) + 1.0);
+      auto size = static_cast<uint64_t>(
+          std::exp(low + (high - low) * random.Unit()));
+      return std::clamp(size, options.min_size, options.max_size);
+    }
+    case Options::Sizes::kClustered: {
+      uint64_t spread = std::max<uint64_t>(1, options.max_size / 100);
+      uint64_t low = std::max(options.min_size, options.max_size - spread);
+      return random.Between(low, options.max_size);
+    }
+    case Options::Sizes::kUniform:
+      break;
+  }
+  return random.Between(options.min_size, options.max_size);
+}
+
+auto AppendElement(BufferedOutput& out, uint64_t index, uint64_t size)
+    -> void {
+  out.Append("el");
+  out.AppendNumber(index);
+  out.Append(' ');
+  out.AppendNumber(size);
+  out.Append('\n');
+}
+
+}  // namespace
+
+PartitionGenerator::PartitionGenerator(PartitionGeneratorOptions options)
+    : options_(options) {
+  if (options_.n == 0) {
+    throw std::invalid_argument("n must be positive");
+  }
+  if (options_.answer == Options::Answer::kSolvable && options_.n < 2) {
+    throw std::invalid_argument("A planted split needs n >= 2");
+  }
+  if (options_.min_size == 0 || options_.min_size > options_.max_size) {
+    throw std::invalid_argument("Sizes need 1 <= min_size <= max_size");
+  }
+  if (options_.max_size > kMaxTotal / 2 / options_.n) {
+    throw std::invalid_argument("n * max_size is too large for 64-bit sums");
+  }
+}
+
+auto PartitionGenerator::Generate(std::ostream& output,
+                                  std::ostream* answer) const -> void {
+  RandomSource random(options_.seed);
+  BufferedOutput out(output);
+  std::unique_ptr<BufferedOutput> answer_out;
+  if (answer != nullptr && options_.answer == Options::Answer::kSolvable) {
+    answer_out = std::make_unique<BufferedOutput>(*answer, size_t{1} << 16);
+  }
+
+  const auto n = options_.n;
+  out.AppendNumber(n);
+  out.Append('\n');
+  uint64_t sides[2] = {0, 0};  // answer side, other side
+  uint64_t total = 0;
+  uint64_t random_count =
+      options_.answer == Options::Answer::kSolvable ? n - 2 : n;
+  for (uint64_t i = 0; i < random_count; ++i) {
+    auto size = DrawSize(options_, random);
+    if (options_.answer == Options::Answer::kUnsolvable && i + 1 == n &&
+        (total + size) % 2 == 0) {
+      ++size;
+    }
+    if (options_.answer == Options::Answer::kSolvable) {
+      int side = sides[0] <= sides[1] ? 0 : 1;
+      sides[side] += size;
+      if (side == 0 && answer_out) {
+        answer_out->Append("el");
+        answer_out->AppendNumber(i);
+        answer_out->Append('\n');
+      }
+    }
+    total += size;
+    AppendElement(out, i, size);
+  }
+
+  if (options_.answer == Options::Answer::kSolvable) {
+    int heavier = sides[0] >= sides[1] ? 0 : 1;
+    uint64_t gap = sides[heavier] - sides[1 - heavier];
+    uint64_t base = DrawSize(options_, random);
+    // el(n-2) joins the heavier side, el(n-1) the lighter one.
+    const uint64_t last_sizes[2] = {base, base + gap};
+    for (int j = 0; j < 2; ++j) {
+      uint64_t index = n - 2 + static_cast<uint64_t>(j);
+      int side = j == 0 ? heavier : 1 - heavier;
+      if (side == 0 && answer_out) {
+        answer_out->Append("el");
+        answer_out->AppendNumber(index);
+        answer_out->Append('\n');
+      }
+      AppendElement(out, index, last_sizes[j]);
+    }
+  }
+
+  out.Flush();
+  if (answer_out) {
+    answer_out->Flush();
+  }
+  if (!output || (answer_out && !*answer)) {
+    throw std::runtime_error("Error writing the generated instance");
+  }
+}
+
+}  // namespace partition
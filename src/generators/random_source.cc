@@ -0,0 +1,74 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for RandomSource.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "generators/random_source.h"
+
+namespace partition {
+
+namespace {
+
+auto RotateLeft(uint64_t value, int shift) -> uint64_t {
+  return (value << shift) | (value >> (64 - shift));
+}
+
+auto SplitMix64(uint64_t& state) -> uint64_t {
+  uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+}  // namespace
+
+RandomSource::RandomSource(uint64_t seed) {
+  for (auto& word : state_) {
+    word = SplitMix64(seed);
+  }
+}
+
+auto RandomSource::Next() -> uint64_t {
+  uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+  uint64_t t = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= t;
+  state_[3] = RotateLeft(state_[3], 45);
+  return result;
+}
+
+auto RandomSource::Below(uint64_t bound) -> uint64_t {
+  __extension__ typedef unsigned __int128 Wide;
+  Wide product = static_cast<Wide>(Next()) * bound;
+  auto low = static_cast<uint64_t>(product);
+  if (low < bound) {
+    uint64_t threshold = -bound % bound;
+    while (low < threshold) {
+      product = static_cast<Wide>(Next()) * bound;
+      low = static_cast<uint64_t>(product);
+    }
+  }
+  return static_cast<uint64_t>(product >> 64);
+}
+
+auto RandomSource::Between(uint64_t low, uint64_t high) -> uint64_t {
+  if (high - low == UINT64_MAX) {
+    return Next();
+  }
+  return low + Below(high - low + 1);
+}
+
+auto RandomSource::Unit() -> double {
+  return static_cast<double>(Next() >> 11) * 0x1.0p-53;
+}
+
+}  // namespace partition
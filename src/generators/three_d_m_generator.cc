@@ -0,0 +1,243 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ThreeDMGenerator.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "generators/three_d_m_generator.h"
+#include "generators/random_source.h"
+#include "util/buffered_output.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+using Options = ThreeDMGeneratorOptions;
+
+/**
+ * @brief Draws 0-based element indices of one set following the chosen
+ * degree distribution.
+ */
+class ElementSampler {
+ public:
+  ElementSampler(const Options& options, RandomSource& random)
+      : degree_(options.degree), q_(options.q), random_(random) {
+    if (degree_ == Options::Degree::kZipf) {
+      BuildAliasTable(options.zipf_exponent);
+    } else if (degree_ == Options::Degree::kRegular) {
+      cycle_.resize(q_);
+      std::iota(cycle_.begin(), cycle_.end(), 0);
+      cursor_ = q_;
+    }
+  }
+
+  auto Next() -> uint64_t {
+    switch (degree_) {
+      case Options::Degree::kZipf: {
+        auto column = random_.Below(q_);
+        return random_.Unit() < probability_[column] ? column : alias_[column];
+      }
+      case Options::Degree::kRegular:
+        if (cursor_ == q_) {
+          random_.Shuffle(cycle_);
+          cursor_ = 0;
+        }
+        return cycle_[cursor_++];
+      case Options::Degree::kUniform:
+        break;
+    }
+    return random_.Below(q_);
+  }
+
+ private:
+  /**
+   * @brief Walker's alias method (Vose's construction): O(1) draws from
+   * the Zipf weights, instead of a binary search over q cumulative values.
+   */
+  auto BuildAliasTable(double exponent) -> void {
+    probability_.resize(q_);
+    alias_.resize(q_);
+    double total = 0.0;
+    for (uint64_t i = 0; i < q_; ++i) {
+      probability_[i] = 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+      total += probability_[i];
+    }
+    std::vector<uint64_t> small;
+    std::vector<uint64_t> large;
+    for (uint64_t i = 0; i < q_; ++i) {
+      probability_[i] *= static_cast<double>(q_) / total;
+      (probability_[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      auto low = small.back();
+      small.pop_back();
+      auto high = large.back();
+      alias_[low] = high;
+      probability_[high] -= 1.0 - probability_[low];
+      if (probability_[high] < 1.0) {
+        large.pop_back();
+        small.push_back(high);
+      }
+    }
+    // Leftovers are 1 up to rounding.
+    for (auto i : small) {
+      probability_[i] = 1.0;
+    }
+    for (auto i : large) {
+      probability_[i] = 1.0;
+    }
+  }
+
+  Options::Degree degree_;
+  uint64_t q_;
+  RandomSource& random_;
+  std::vector<double> probability_;
+  std::vector<uint64_t> alias_;
+  std::vector<uint64_t> cycle_;
+  uint64_t cursor_ = 0;
+};
+
+using TripleIndices = std::array<uint64_t, 3>;
+
+auto AppendTriple(BufferedOutput& out, const TripleIndices& triple,
+                  Options::Format format) -> void {
+  if (format == Options::Format::kBinary) {
+    for (auto index : triple) {
+      out.AppendUint32(static_cast<uint32_t>(index));
+    }
+    return;
+  }
+  const char prefixes[3] = {'w', 'x', 'y'};
+  for (int set = 0; set < 3; ++set) {
+    out.Append(prefixes[set]);
+    out.AppendNumber(triple[set] + 1);
+    out.Append(set == 2 ? '\n' : ' ');
+  }
+}
+
+}  // namespace
+
+ThreeDMGenerator::ThreeDMGenerator(ThreeDMGeneratorOptions options)
+    : options_(options) {
+  if (options_.q == 0) {
+    throw std::invalid_argument("q must be positive");
+  }
+  if (options_.answer == Options::Answer::kPlanted && options_.k < options_.q) {
+    throw std::invalid_argument("A planted matching needs k >= q");
+  }
+  if (options_.answer == Options::Answer::kNoMatching &&
+      (options_.q < 3 || options_.k < options_.q + 1)) {
+    throw std::invalid_argument(
+        "Guaranteeing no matching with full coverage needs q >= 3 and "
+        "k >= q + 1");
+  }
+  if (options_.format == Options::Format::kBinary &&
+      (options_.q > std::numeric_limits<uint32_t>::max() ||
+       options_.k > std::numeric_limits<uint32_t>::max())) {
+    throw std::invalid_argument("q and k must fit in 32 bits for binary output");
+  }
+  if (options_.degree == Options::Degree::kZipf &&
+      !(options_.zipf_exponent >= 0.0)) {
+    throw std::invalid_argument("The Zipf exponent must be non-negative");
+  }
+}
+
+auto ThreeDMGenerator::Generate(std::ostream& output,
+                                std::ostream* answer) const -> void {
+  const auto q = options_.q;
+  const auto k = options_.k;
+  RandomSource random(options_.seed);
+
+  // Backbone: the planted matching, or the covering near-matching that
+  // rules one out.
+  std::vector<TripleIndices> backbone;
+  uint64_t forced_x[2] = {q, q};  // Only paired with w1; q means none.
+  if (options_.answer != Options::Answer::kRandom) {
+    std::vector<uint64_t> sigma(q);
+    std::vector<uint64_t> tau(q);
+    std::iota(sigma.begin(), sigma.end(), 0);
+    std::iota(tau.begin(), tau.end(), 0);
+    random.Shuffle(sigma);
+    random.Shuffle(tau);
+    backbone.reserve(q + 1);
+    for (uint64_t i = 0; i < q; ++i) {
+      backbone.push_back({i, sigma[i], tau[i]});
+    }
+    if (options_.answer == Options::Answer::kNoMatching) {
+      forced_x[0] = sigma[0];
+      forced_x[1] = sigma[1];
+      backbone[1][0] = 0;                        // (w1, x_sigma(2), y_tau(2))
+      backbone.push_back({1, sigma[2], tau[2]});  // keeps w2 covered
+    }
+    random.Shuffle(backbone);
+  }
+
+  BufferedOutput out(output);
+  if (options_.format == Options::Format::kBinary) {
+    out.Append("3DMB");
+    out.AppendUint32(static_cast<uint32_t>(q));
+    out.AppendUint32(static_cast<uint32_t>(k));
+  } else {
+    out.AppendNumber(q);
+    out.Append('\n');
+    for (char set : {'w', 'x', 'y'}) {
+      for (uint64_t i = 1; i <= q; ++i) {
+        out.Append(set);
+        out.AppendNumber(i);
+        out.Append(i == q ? '\n' : ' ');
+      }
+    }
+  }
+
+  std::unique_ptr<BufferedOutput> answer_out;
+  if (answer != nullptr && options_.answer == Options::Answer::kPlanted) {
+    answer_out = std::make_unique<BufferedOutput>(*answer, size_t{1} << 16);
+  }
+
+  ElementSampler w_sampler(options_, random);
+  ElementSampler x_sampler(options_, random);
+  ElementSampler y_sampler(options_, random);
+  size_t next_backbone = 0;
+  for (uint64_t t = 0; t < k; ++t) {
+    // Selection sampling: the backbone triples land on uniformly random
+    // positions without knowing them in advance.
+    uint64_t needed = backbone.size() - next_backbone;
+    TripleIndices triple;
+    if (needed > 0 && random.Below(k - t) < needed) {
+      triple = backbone[next_backbone++];
+      if (answer_out) {
+        AppendTriple(*answer_out, triple, Options::Format::kText);
+      }
+    } else {
+      triple = {w_sampler.Next(), x_sampler.Next(), y_sampler.Next()};
+      if (triple[1] == forced_x[0] || triple[1] == forced_x[1]) {
+        triple[0] = 0;
+      }
+    }
+    AppendTriple(out, triple, options_.format);
+  }
+
+  out.Flush();
+  if (answer_out) {
+    answer_out->Flush();
+  }
+  if (!output || (answer_out && !*answer)) {
+    throw std::runtime_error("Error writing the generated instance");
+  }
+}
+
+}  // namespace partition
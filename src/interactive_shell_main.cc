@@ -9,11 +9,15 @@
  * @date 11-12-2025
  */
 
-#include "io/three_d_m_reader.h"
 #include "io/three_d_m_reader.h"
 #include "io/three_d_m_writer.h"
-#include "io/partition_writer.h"
+#include "io/instance_pack_reader.h"
+#include "io/reduced_partition_writer.h"
+#include "pipeline/batch_runner.h"
+#include "reduction/feasibility_precheck.h"
 #include "reduction/three_d_m_to_partition_reducer.h"
+#include "util/memory_accounting.h"
+#include "util/metrics.h"
 #include <iostream>
 #include <string>
 #include <fstream>
@@ -24,19 +28,33 @@ void PrintHelp(const char* programName) {
   std::cout << "=== 3DM TO PARTITION CONVERTER ===" << std::endl << std::endl;
   std::cout << "Usage:" << std::endl;
   std::cout << "  " << programName << " -i <input_file> -o <output_file>" << std::endl;
+  std::cout << "  " << programName << " -b <dir|pack|glob|-> [-o <output_dir>] [-j <threads>] [-m <bytes>]" << std::endl;
   std::cout << "  " << programName << " -h | --help" << std::endl << std::endl;
   std::cout << "Options:" << std::endl;
   std::cout << "  -i <file>   Input file containing the 3DM instance" << std::endl;
-  std::cout << "  -o <file>   Output file for the Partition instance" << std::endl;
+  std::cout << "  -o <file>   Output file for the Partition instance (directory in batch mode)" << std::endl;
+  std::cout << "  -b <source> Batch mode: reduce every instance in a directory, a pack" << std::endl;
+  std::cout << "              file, a glob pattern or, with -, a list of paths read from stdin." << std::endl;
+  std::cout << "              Prints one JSON record per instance and nothing else." << std::endl;
+  std::cout << "  -j <n>      Batch worker threads (default: one per core)" << std::endl;
+  std::cout << "  -m <bytes>  Batch memory budget, e.g. 512M or 4G. Jobs wait until their" << std::endl;
+  std::cout << "              estimated memory fits; larger ones are refused." << std::endl;
+  std::cout << "  --metrics <file>  Write phase timings and counters on exit (JSON, or" << std::endl;
+  std::cout << "              Prometheus text for *.prom). Needs -DPARTITION_ENABLE_METRICS=ON." << std::endl;
   std::cout << "  -h, --help  Show this help message" << std::endl << std::endl;
   std::cout << "Example:" << std::endl;
-  std::cout << "  " << programName << " -i ../instances/3DM/3dm-1.txt -o output.txt" << std::endl << std::endl;
+  std::cout << "  " << programName << " -i ../instances/3DM/3dm-1.txt -o output.txt" << std::endl;
+  std::cout << "  " << programName << " -b '../instances/3DM/3dm-?.txt' -o reduced > results.jsonl" << std::endl << std::endl;
 }
 
 int main(int argc, char* argv[]) {
   partition::ThreeDMReader reader;
   std::string filename;
-  std::string output = "output_reduction.txt";
+  std::string output;
+  std::string batch_source;
+  size_t batch_threads = 0;
+  size_t memory_budget = 0;
+  std::string metrics_file;
 
   // -------------- ARGUMENT PARSING --------------
   for (int i = 1; i < argc; ++i) {
@@ -52,6 +70,52 @@ int main(int argc, char* argv[]) {
       output = argv[i + 1];
       ++i;
     }
+    else if (std::strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      batch_source = argv[i + 1];
+      ++i;
+    }
+    else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      batch_threads = std::stoul(argv[i + 1]);
+      ++i;
+    }
+    else if (std::strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+      memory_budget = partition::ParseByteSize(argv[i + 1]);
+      ++i;
+    }
+    else if (std::strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+      metrics_file = argv[i + 1];
+      ++i;
+    }
+  }
+
+  // -------------- BATCH MODE --------------
+  if (!batch_source.empty()) {
+    try {
+      partition::BatchOptions options;
+      options.output_dir = output.empty() ? "." : output;
+      options.threads = batch_threads;
+      options.memory_budget = memory_budget;
+      partition::BatchRunner runner(options);
+      partition::BatchSummary summary;
+      if (partition::InstancePackReader::IsPack(batch_source)) {
+        partition::InstancePackReader pack(batch_source);
+        summary = runner.Run(pack, std::cout);
+      } else {
+        auto inputs = partition::BatchRunner::CollectInputs(batch_source, std::cin);
+        summary = runner.Run(inputs, std::cout);
+      }
+      if (!metrics_file.empty()) {
+        partition::MetricsRegistry::Global().WriteToFile(metrics_file);
+      }
+      return summary.failed == 0 && summary.refused == 0 ? 0 : 1;
+    }
+    catch (const std::exception& e) {
+      std::cerr << "ERROR: " << e.what() << std::endl;
+      return 1;
+    }
+  }
+  if (output.empty()) {
+    output = "output_reduction.txt";
   }
 
   // -------------- INTERACTIVE MODE --------------
@@ -102,16 +166,33 @@ int main(int argc, char* argv[]) {
 
     std::cout << std::endl << "Converting to Partition instance..." << std::endl;
     partition::ThreeDMToPartitionReducer reducer;
-    partition::PartitionInstance partition_instance = reducer.Reduce(three_dm_instance);
+    partition::ReducedPartitionInstance partition_instance = reducer.ReduceCompact(three_dm_instance);
+
+    // b1 = 2T - B is negative, so there is no Partition instance to write;
+    // some element is in no triple and the answer is NO.
+    if (partition_instance.FillerUnderflows()) {
+      auto certificate = partition::FeasibilityPrecheck().Check(three_dm_instance);
+      std::cout << std::endl << "Uncovered element, trivially NO." << std::endl;
+      if (certificate) {
+        std::cout << "Precheck ("
+                  << partition::InfeasibilityCertificate::ReasonName(certificate->reason)
+                  << "): " << certificate->explanation << std::endl;
+      }
+      std::cout << "No output written." << std::endl;
+      return 0;
+    }
 
     std::cout << std::endl << "=== CONVERTED PARTITION INSTANCE ===" << std::endl;
     std::cout << partition_instance.ToString() << std::endl;
 
-    partition::PartitionWriter partition_writer;
+    partition::ReducedPartitionWriter partition_writer;
     partition_writer.WriteToFile(partition_instance, output);
 
     std::cout << std::endl << "Output successfully written to:" << std::endl;
     std::cout << "  " << output << std::endl << std::endl;
+    if (!metrics_file.empty()) {
+      partition::MetricsRegistry::Global().WriteToFile(metrics_file);
+    }
     std::cout << "Done." << std::endl;
 
     return 0;
@@ -0,0 +1,154 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the instance pack format helpers.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/instance_pack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Bounds-checked little-endian cursor over the index bytes.
+ */
+class IndexCursor {
+ public:
+  IndexCursor(std::string_view data, size_t position)
+      : data_(data), position_(position) {}
+
+  auto Read(size_t bytes) -> std::string_view {
+    if (bytes > data_.size() - position_) {
+      throw std::runtime_error("Invalid pack: truncated index");
+    }
+    auto view = data_.substr(position_, bytes);
+    position_ += bytes;
+    return view;
+  }
+
+  template <typename Unsigned>
+  auto ReadInteger() -> Unsigned {
+    auto bytes = Read(sizeof(Unsigned));
+    Unsigned value = 0;
+    for (size_t i = 0; i < sizeof(Unsigned); ++i) {
+      value |= static_cast<Unsigned>(static_cast<unsigned char>(bytes[i]))
+               << (8 * i);
+    }
+    return value;
+  }
+
+  auto position() const -> size_t { return position_; }
+
+ private:
+  std::string_view data_;
+  size_t position_;
+};
+
+template <typename Unsigned>
+auto AppendInteger(std::string& out, Unsigned value) -> void {
+  for (size_t i = 0; i < sizeof(Unsigned); ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+}  // namespace
+
+auto PackHash(std::string_view data) -> uint64_t {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (char c : data) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+auto ParsePackIndex(std::string_view pack) -> std::vector<PackEntry> {
+  if (pack.size() < kPackHeaderSize + kPackTrailerSize ||
+      std::memcmp(pack.data(), kPackMagic, sizeof(kPackMagic)) != 0) {
+    throw std::runtime_error("Invalid pack: bad header");
+  }
+  IndexCursor header(pack, sizeof(kPackMagic));
+  if (header.ReadInteger<uint32_t>() != kPackVersion) {
+    throw std::runtime_error("Invalid pack: unsupported version");
+  }
+  size_t trailer_start = pack.size() - kPackTrailerSize;
+  IndexCursor trailer(pack, trailer_start);
+  auto index_offset = trailer.ReadInteger<uint64_t>();
+  auto count = trailer.ReadInteger<uint64_t>();
+  if (std::memcmp(trailer.Read(sizeof(kPackEndMagic)).data(), kPackEndMagic,
+                  sizeof(kPackEndMagic)) != 0) {
+    throw std::runtime_error("Invalid pack: bad trailer (unfinished write?)");
+  }
+  if (index_offset < kPackHeaderSize || index_offset > trailer_start) {
+    throw std::runtime_error("Invalid pack: index offset out of range");
+  }
+
+  // Each entry takes at least 29 bytes, which bounds the reservation.
+  std::vector<PackEntry> entries;
+  entries.reserve(std::min<uint64_t>(count, (trailer_start - index_offset) / 29));
+  IndexCursor cursor(pack.substr(0, trailer_start), index_offset);
+  for (uint64_t i = 0; i < count; ++i) {
+    PackEntry entry;
+    auto name_length = cursor.ReadInteger<uint32_t>();
+    entry.name = std::string(cursor.Read(name_length));
+    auto kind = cursor.ReadInteger<uint8_t>();
+    if (kind < 1 || kind > 3) {
+      throw std::runtime_error("Invalid pack: unknown kind for " + entry.name);
+    }
+    entry.kind = static_cast<PackEntryKind>(kind);
+    entry.offset = cursor.ReadInteger<uint64_t>();
+    entry.length = cursor.ReadInteger<uint64_t>();
+    entry.hash = cursor.ReadInteger<uint64_t>();
+    if (entry.offset < kPackHeaderSize || entry.offset > index_offset ||
+        entry.length > index_offset - entry.offset) {
+      throw std::runtime_error("Invalid pack: payload out of range for " +
+                               entry.name);
+    }
+    entries.push_back(std::move(entry));
+  }
+  if (cursor.position() != trailer_start) {
+    throw std::runtime_error("Invalid pack: index size mismatch");
+  }
+  return entries;
+}
+
+auto SerializePackIndex(const std::vector<PackEntry>& entries,
+                        uint64_t index_offset) -> std::string {
+  std::string out;
+  for (const auto& entry : entries) {
+    AppendInteger<uint32_t>(out, static_cast<uint32_t>(entry.name.size()));
+    out += entry.name;
+    AppendInteger<uint8_t>(out, static_cast<uint8_t>(entry.kind));
+    AppendInteger<uint64_t>(out, entry.offset);
+    AppendInteger<uint64_t>(out, entry.length);
+    AppendInteger<uint64_t>(out, entry.hash);
+  }
+  AppendInteger<uint64_t>(out, index_offset);
+  AppendInteger<uint64_t>(out, entries.size());
+  out.append(kPackEndMagic, sizeof(kPackEndMagic));
+  return out;
+}
+
+auto PackEntryKindName(PackEntryKind kind) -> std::string {
+  switch (kind) {
+    case PackEntryKind::kThreeDMText:
+      return "3dm";
+    case PackEntryKind::kThreeDMBinary:
+      return "3dm-binary";
+    case PackEntryKind::kPartitionText:
+      return "partition";
+  }
+  return "unknown";
+}
+
+}  // namespace partition
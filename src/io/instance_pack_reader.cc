@@ -0,0 +1,139 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for InstancePackReader.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/instance_pack_reader.h"
+#include "io/partition_reader.h"
+#include "io/three_d_m_binary_reader.h"
+#include "io/three_d_m_reader.h"
+#include "util/memory_stream.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace partition {
+
+InstancePackReader::InstancePackReader(const std::string& filename) {
+  int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) < 0) {
+    ::close(fd);
+    throw std::runtime_error("Could not stat file: " + filename);
+  }
+  length_ = static_cast<size_t>(info.st_size);
+  if (length_ > 0) {
+    void* mapping = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error("Could not map file: " + filename + ": " +
+                               std::strerror(errno));
+    }
+    data_ = static_cast<const char*>(mapping);
+  }
+  ::close(fd);
+  try {
+    entries_ = ParsePackIndex(std::string_view(data_, length_));
+  } catch (const std::exception& e) {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char*>(data_), length_);
+    }
+    throw std::runtime_error(filename + ": " + e.what());
+  }
+  by_name_.reserve(entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    by_name_.emplace(entries_[i].name, i);
+  }
+}
+
+InstancePackReader::~InstancePackReader() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), length_);
+  }
+}
+
+auto InstancePackReader::IsPack(const std::string& filename) -> bool {
+  std::ifstream file(filename, std::ios::binary);
+  char magic[sizeof(kPackMagic)];
+  return file.read(magic, sizeof(magic)) &&
+         std::memcmp(magic, kPackMagic, sizeof(magic)) == 0;
+}
+
+auto InstancePackReader::Find(std::string_view name) const
+    -> std::optional<size_t> {
+  auto found = by_name_.find(name);
+  if (found == by_name_.end()) {
+    return std::nullopt;
+  }
+  return found->second;
+}
+
+auto InstancePackReader::Payload(size_t index) const -> std::string_view {
+  const auto& selected = entries_.at(index);
+  return {data_ + selected.offset, selected.length};
+}
+
+auto InstancePackReader::Verify(size_t index) const -> bool {
+  return PackHash(Payload(index)) == entries_.at(index).hash;
+}
+
+auto InstancePackReader::ReadThreeDM(size_t index,
+                                     std::pmr::memory_resource* resource) const
+    -> ThreeDMInstance {
+  const auto& selected = entries_.at(index);
+  MemoryInputStream input(Payload(index));
+  switch (selected.kind) {
+    case PackEntryKind::kThreeDMText:
+      return ThreeDMReader(resource).ReadFromStream(input);
+    case PackEntryKind::kThreeDMBinary:
+      return ThreeDMBinaryReader(resource).ReadFromStream(input);
+    default:
+      throw std::runtime_error("Pack entry " + selected.name +
+                               " is not a 3DM instance");
+  }
+}
+
+auto InstancePackReader::ReadThreeDMShape(size_t index) const
+    -> ThreeDMShape {
+  const auto& selected = entries_.at(index);
+  MemoryInputStream input(Payload(index));
+  switch (selected.kind) {
+    case PackEntryKind::kThreeDMText:
+      return ThreeDMReader::ReadShape(input);
+    case PackEntryKind::kThreeDMBinary:
+      return ThreeDMBinaryReader::ReadShape(input);
+    default:
+      throw std::runtime_error("Pack entry " + selected.name +
+                               " is not a 3DM instance");
+  }
+}
+
+auto InstancePackReader::ReadPartition(
+    size_t index, std::pmr::memory_resource* resource) const
+    -> PartitionInstance {
+  const auto& selected = entries_.at(index);
+  if (selected.kind != PackEntryKind::kPartitionText) {
+    throw std::runtime_error("Pack entry " + selected.name +
+                             " is not a Partition instance");
+  }
+  MemoryInputStream input(Payload(index));
+  return PartitionReader(resource).ReadFromStream(input);
+}
+
+}  // namespace partition
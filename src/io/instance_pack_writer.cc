@@ -0,0 +1,105 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for InstancePackWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/instance_pack_writer.h"
+#include "io/instance_pack_reader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+namespace partition {
+
+InstancePackWriter::InstancePackWriter(const std::string& filename, Mode mode)
+    : filename_(filename) {
+  if (mode == Mode::kAppend && std::filesystem::exists(filename)) {
+    {
+      InstancePackReader existing(filename);
+      entries_ = existing.entries();
+    }
+    end_offset_ = kPackHeaderSize;
+    for (const auto& entry : entries_) {
+      names_.insert(entry.name);
+      end_offset_ = std::max(end_offset_, entry.offset + entry.length);
+    }
+    file_.open(filename, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file_.is_open()) {
+      throw std::runtime_error("Could not open file: " + filename);
+    }
+    file_.seekp(static_cast<std::streamoff>(end_offset_));
+    return;
+  }
+  file_.open(filename,
+             std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file_.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  char header[kPackHeaderSize] = {};
+  std::copy(std::begin(kPackMagic), std::end(kPackMagic), header);
+  header[8] = static_cast<char>(kPackVersion & 0xFF);
+  file_.write(header, sizeof(header));
+  end_offset_ = kPackHeaderSize;
+}
+
+InstancePackWriter::~InstancePackWriter() {
+  try {
+    Finish();
+  } catch (const std::exception&) {
+    // Destructors must not throw; the pack stays without a trailer and
+    // readers will reject it.
+  }
+}
+
+auto InstancePackWriter::Add(const std::string& name, PackEntryKind kind,
+                             std::string_view payload) -> void {
+  if (finished_) {
+    throw std::runtime_error("Pack already finished: " + filename_);
+  }
+  if (!names_.insert(name).second) {
+    throw std::runtime_error("Duplicate pack entry: " + name);
+  }
+  file_.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  if (!file_) {
+    throw std::runtime_error("Error writing to file: " + filename_);
+  }
+  entries_.push_back({name, kind, end_offset_, payload.size(),
+                      PackHash(payload)});
+  end_offset_ += payload.size();
+}
+
+auto InstancePackWriter::AddFile(const std::string& name, PackEntryKind kind,
+                                 const std::string& path) -> void {
+  std::ifstream input(path, std::ios::binary);
+  if (!input.is_open()) {
+    throw std::runtime_error("Could not open file: " + path);
+  }
+  std::ostringstream contents;
+  contents << input.rdbuf();
+  Add(name, kind, contents.str());
+}
+
+auto InstancePackWriter::Finish() -> void {
+  if (finished_) {
+    return;
+  }
+  finished_ = true;
+  auto index = SerializePackIndex(entries_, end_offset_);
+  file_.write(index.data(), static_cast<std::streamsize>(index.size()));
+  file_.close();
+  if (!file_) {
+    throw std::runtime_error("Error writing to file: " + filename_);
+  }
+  // Appending fewer bytes than the old index leaves stale bytes behind.
+  std::filesystem::resize_file(filename_, end_offset_ + index.size());
+}
+
+}  // namespace partition
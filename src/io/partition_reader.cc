@@ -10,6 +10,8 @@
  */
 
 #include "io/partition_reader.h"
+#include "core/partition_instance_builder.h"
+#include "util/metrics.h"
 #include <sstream>
 
 namespace partition {
@@ -24,10 +26,13 @@ namespace partition {
 
   auto PartitionReader::ReadFromStream(std::istream& input) const
       -> PartitionInstance {
-    PartitionInstance instance; 
+    PARTITION_METRICS_PHASE(kParse);
+    PartitionInstanceBuilder builder(resource_);
     std::string line;
-    int n;
+    size_t bytes_parsed = 0;
+    int n = 0;
     while (std::getline(input, line)) {
+      bytes_parsed += line.size() + 1;
       auto comment_pos = line.find('#');
       if (comment_pos != std::string::npos) {
         line = line.substr(0, comment_pos);
@@ -37,10 +42,10 @@ namespace partition {
         break;
       }
     }    
-    std::vector<PartitionElement> elements;
-    elements.reserve(n);
+    builder.Reserve(n);
     for (int i = 0; i < n; ++i) {
       while (std::getline(input, line)) {
+        bytes_parsed += line.size() + 1;
         auto comment_pos = line.find('#');
         if (comment_pos != std::string::npos) {
           line = line.substr(0, comment_pos);
@@ -49,13 +54,13 @@ namespace partition {
         std::string id;
         int64_t size;
         if (iss >> id >> size) {
-          elements.emplace_back(id, size);
+          builder.EmplaceElement(id, size);
           break;
         }
       }
     }   
-    instance.SetElements(elements);
-    return instance;
+    PARTITION_METRICS_COUNT(kBytesParsed, bytes_parsed);
+    return builder.Build();
   }
 
   auto PartitionReader::GetFormatDescription() const -> std::string {
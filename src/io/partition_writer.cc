@@ -10,6 +10,7 @@
  */
 
 #include "io/partition_writer.h"
+#include "util/metrics.h"
 #include <fstream>
 
 namespace partition {
@@ -25,6 +26,7 @@ namespace partition {
   auto PartitionWriter::WriteToStream(const PartitionInstance& instance,
                                       std::ostream& output) const
       -> void {
+    PARTITION_METRICS_PHASE(kWrite);
     output << instance.size() << '\n';
     for (const auto& element : instance.elements()) {
       output << element.id() << ' ' << element.size() << '\n';
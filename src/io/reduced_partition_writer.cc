@@ -0,0 +1,59 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ReducedPartitionWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/reduced_partition_writer.h"
+#include "util/metrics.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace partition {
+
+auto ReducedPartitionWriter::WriteToFile(
+    const ReducedPartitionInstance& instance, const std::string& filename) const
+    -> void {
+  std::ofstream file_stream(filename);
+  if (!file_stream.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  WriteToStream(instance, file_stream);
+}
+
+auto ReducedPartitionWriter::WriteToStream(
+    const ReducedPartitionInstance& instance, std::ostream& output) const
+    -> void {
+  PARTITION_METRICS_PHASE(kWrite);
+  auto k = instance.triple_count();
+  output << instance.size() << '\n';
+  for (size_t i = 0; i < k; ++i) {
+    output << "a_" << i << ' ';
+    auto positions = instance.positions(i);
+    if (instance.bit_width() <= 64) {
+      uint64_t size = 0;
+      for (uint32_t position : positions) {
+        size += uint64_t{1} << position;
+      }
+      output << size << '\n';
+    } else {
+      output << instance.ElementSize(i).ToDecimalString() << '\n';
+    }
+  }
+  output << "b1 " << instance.ElementSize(k).ToDecimalString() << '\n';
+  output << "b2 " << instance.ElementSize(k + 1).ToDecimalString() << '\n';
+}
+
+auto ReducedPartitionWriter::GetFormatDescription() const -> std::string {
+  return "Partition instance format:\n"
+         "- Line 1: n (number of elements)\n"
+         "- Line 2+: Element ID and size, one per line as 'id size'";
+}
+
+}  // namespace partition
@@ -0,0 +1,166 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ThreeDMBinaryReader.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/three_d_m_binary_reader.h"
+#include "core/three_d_m_instance_builder.h"
+#include "util/metrics.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+auto ReadUint32(std::istream& input) -> uint32_t {
+  std::array<unsigned char, 4> bytes{};
+  if (!input.read(reinterpret_cast<char*>(bytes.data()), bytes.size())) {
+    throw std::runtime_error("Invalid binary 3DM: unexpected end of input");
+  }
+  return static_cast<uint32_t>(bytes[0]) |
+         static_cast<uint32_t>(bytes[1]) << 8 |
+         static_cast<uint32_t>(bytes[2]) << 16 |
+         static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+/**
+ * @brief Bytes between the read position and the end, or std::nullopt if
+ * the stream cannot seek.
+ */
+auto RemainingBytes(std::istream& input) -> std::optional<uint64_t> {
+  auto here = input.tellg();
+  if (here == std::istream::pos_type(-1)) {
+    input.clear();
+    return std::nullopt;
+  }
+  input.seekg(0, std::ios::end);
+  auto end = input.tellg();
+  input.clear();
+  input.seekg(here);
+  if (end == std::istream::pos_type(-1) || !input) {
+    input.clear();
+    return std::nullopt;
+  }
+  return static_cast<uint64_t>(end - here);
+}
+
+/**
+ * @brief Reads the magic, q and k, and checks them against each other and
+ * against the bytes left before anything is sized from them: q and k come
+ * straight from the input.
+ */
+auto ReadHeader(std::istream& input) -> std::pair<uint32_t, uint32_t> {
+  char magic[4];
+  if (!input.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, "3DMB", sizeof(magic)) != 0) {
+    throw std::runtime_error("Invalid binary 3DM: bad magic");
+  }
+  uint32_t q = ReadUint32(input);
+  uint32_t k = ReadUint32(input);
+  if (q == 0) {
+    throw std::runtime_error("Invalid binary 3DM: q must be positive");
+  }
+  if (q > k) {
+    throw std::runtime_error("Invalid binary 3DM: q = " + std::to_string(q) +
+                             " exceeds k = " + std::to_string(k) +
+                             ", so no perfect matching exists");
+  }
+  auto remaining = RemainingBytes(input);
+  if (remaining && *remaining != uint64_t{12} * k) {
+    throw std::runtime_error(
+        "Invalid binary 3DM: header announces " + std::to_string(k) +
+        " triples (" + std::to_string(uint64_t{12} * k) + " bytes) but " +
+        std::to_string(*remaining) + " bytes follow");
+  }
+  return {q, k};
+}
+
+}  // namespace
+
+auto ThreeDMBinaryReader::ReadFromFile(const std::string& filename) const
+    -> ThreeDMInstance {
+  std::ifstream file_stream(filename, std::ios::binary);
+  if (!file_stream.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  return ReadFromStream(file_stream);
+}
+
+auto ThreeDMBinaryReader::ReadShape(std::istream& input) -> ThreeDMShape {
+  ThreeDMShape shape;
+  std::tie(shape.q, shape.k) = ReadHeader(input);
+  // Names are a one-letter prefix and the 1-based index.
+  shape.name_length = 1 + std::to_string(shape.q).size();
+  return shape;
+}
+
+auto ThreeDMBinaryReader::ReadFromStream(std::istream& input) const
+    -> ThreeDMInstance {
+  PARTITION_METRICS_PHASE(kParse);
+  auto [q, k] = ReadHeader(input);
+
+  // The triples come first, so that on a stream that cannot tell its size
+  // memory only grows with the bytes actually received; q <= k bounds the
+  // names by them too.
+  std::vector<std::array<uint32_t, 3>> indices;
+  for (uint32_t t = 0; t < k; ++t) {
+    uint32_t w = ReadUint32(input);
+    uint32_t x = ReadUint32(input);
+    uint32_t y = ReadUint32(input);
+    if (w >= q || x >= q || y >= q) {
+      throw std::runtime_error("Invalid binary 3DM: triple " +
+                               std::to_string(t) + " has an index >= q");
+    }
+    indices.push_back({w, x, y});
+  }
+
+  ThreeDMInstanceBuilder builder(resource_);
+  builder.SetQ(q);
+  std::vector<std::string> names[3];
+  const char prefixes[3] = {'w', 'x', 'y'};
+  for (int set = 0; set < 3; ++set) {
+    ThreeDMInstance::ElementSet elements(resource_);
+    names[set].reserve(q);
+    for (uint32_t i = 1; i <= q; ++i) {
+      names[set].emplace_back(prefixes[set] + std::to_string(i));
+      elements.emplace(names[set].back());
+    }
+    if (set == 0) {
+      builder.SetW(std::move(elements));
+    } else if (set == 1) {
+      builder.SetX(std::move(elements));
+    } else {
+      builder.SetY(std::move(elements));
+    }
+  }
+
+  builder.Reserve(k);
+  for (const auto& [w, x, y] : indices) {
+    builder.EmplaceTriple(names[0][w], names[1][x], names[2][y]);
+  }
+  PARTITION_METRICS_COUNT(kBytesParsed, 12 + uint64_t{12} * k);
+  return builder.Build();
+}
+
+auto ThreeDMBinaryReader::GetFormatDescription() const -> std::string {
+  return "Binary Three-Dimensional Matching format (32-bit little-endian):\n"
+         "- Magic '3DMB'\n"
+         "- q, then k (1 <= q <= k)\n"
+         "- k triples as three 0-based indices 'w x y'";
+}
+
+}  // namespace partition
@@ -0,0 +1,78 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ThreeDMBinaryWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/three_d_m_binary_writer.h"
+#include "util/metrics.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace partition {
+
+namespace {
+
+auto WriteUint32(std::ostream& output, uint32_t value) -> void {
+  const char bytes[4] = {static_cast<char>(value & 0xFF),
+                         static_cast<char>((value >> 8) & 0xFF),
+                         static_cast<char>((value >> 16) & 0xFF),
+                         static_cast<char>((value >> 24) & 0xFF)};
+  output.write(bytes, sizeof(bytes));
+}
+
+auto IndexMap(const ThreeDMInstance::ElementSet& elements)
+    -> std::unordered_map<std::string_view, uint32_t> {
+  std::unordered_map<std::string_view, uint32_t> indices;
+  indices.reserve(elements.size());
+  uint32_t index = 0;
+  for (const auto& element : elements) {
+    indices.emplace(element, index++);
+  }
+  return indices;
+}
+
+}  // namespace
+
+auto ThreeDMBinaryWriter::WriteToFile(const ThreeDMInstance& instance,
+                                      const std::string& filename) const
+    -> void {
+  std::ofstream file_stream(filename, std::ios::binary);
+  if (!file_stream.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  WriteToStream(instance, file_stream);
+}
+
+auto ThreeDMBinaryWriter::WriteToStream(const ThreeDMInstance& instance,
+                                        std::ostream& output) const -> void {
+  PARTITION_METRICS_PHASE(kWrite);
+  auto w_indices = IndexMap(instance.w());
+  auto x_indices = IndexMap(instance.x());
+  auto y_indices = IndexMap(instance.y());
+  output.write("3DMB", 4);
+  WriteUint32(output, static_cast<uint32_t>(instance.q()));
+  WriteUint32(output, static_cast<uint32_t>(instance.triples().size()));
+  for (const auto& triple : instance.triples()) {
+    WriteUint32(output, w_indices.at(triple.w()));
+    WriteUint32(output, x_indices.at(triple.x()));
+    WriteUint32(output, y_indices.at(triple.y()));
+  }
+}
+
+auto ThreeDMBinaryWriter::GetFormatDescription() const -> std::string {
+  return "Binary Three-Dimensional Matching format (32-bit little-endian):\n"
+         "- Magic '3DMB'\n"
+         "- q, then k\n"
+         "- k triples as three 0-based indices 'w x y'";
+}
+
+}  // namespace partition
@@ -10,6 +10,10 @@
  */
 #include "io/three_d_m_reader.h"
 #include "core/three_d_m_instance.h"
+#include "core/three_d_m_instance_builder.h"
+#include "util/metrics.h"
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
 
@@ -23,13 +27,18 @@ namespace partition {
   }
 
   auto ThreeDMReader::ReadFromStream(std::istream& input) const -> ThreeDMInstance {
-    ThreeDMInstance instance;
+    PARTITION_METRICS_PHASE(kParse);
+    ThreeDMInstanceBuilder builder(resource_);
     std::string line;
+    size_t bytes_parsed = 0;
     int line_number = 0;
     size_t q = 0;
-    std::set<std::string> w_elements, x_elements, y_elements;
+    ThreeDMInstance::ElementSet w_elements(resource_);
+    ThreeDMInstance::ElementSet x_elements(resource_);
+    ThreeDMInstance::ElementSet y_elements(resource_);
     
     while (std::getline(input, line)) {
+      bytes_parsed += line.size() + 1;
       auto comment_pos = line.find('#');
       if (comment_pos != std::string::npos) {
         line = line.substr(0, comment_pos);
@@ -49,22 +58,22 @@ namespace partition {
           if (q <= 0) {
             throw std::runtime_error("Invalid format: q must be a positive integer");
           }
-          instance.SetQ(q);
+          builder.SetQ(q);
           break;
         }
         case 1: { // Read W elements
           FillSetFromLine(line_stream, w_elements, q, "W");
-          instance.SetW(w_elements);
+          builder.SetW(std::move(w_elements));
           break;
         }
         case 2: { // Read X elements
           FillSetFromLine(line_stream, x_elements, q, "X");
-          instance.SetX(x_elements);
+          builder.SetX(std::move(x_elements));
           break;
         }
         case 3: { // Read Y elements
           FillSetFromLine(line_stream, y_elements, q, "Y");
-          instance.SetY(y_elements);
+          builder.SetY(std::move(y_elements));
           break;
         }
         default: { // Read triples
@@ -78,20 +87,20 @@ namespace partition {
           }
           
           // Validate that elements belong to the correct sets
-          if (w_elements.find(w) == w_elements.end()) {
+          if (builder.w().find(std::string_view(w)) == builder.w().end()) {
             throw std::runtime_error("Invalid format: Element '" + w + 
                                    "' in triple is not in set W");
           }
-          if (x_elements.find(x) == x_elements.end()) {
+          if (builder.x().find(std::string_view(x)) == builder.x().end()) {
             throw std::runtime_error("Invalid format: Element '" + x + 
                                    "' in triple is not in set X");
           }
-          if (y_elements.find(y) == y_elements.end()) {
+          if (builder.y().find(std::string_view(y)) == builder.y().end()) {
             throw std::runtime_error("Invalid format: Element '" + y + 
                                    "' in triple is not in set Y");
           }
           
-          instance.AddTriple(Triple(w, x, y));
+          builder.EmplaceTriple(w, x, y);
           break;
         }
       }
@@ -103,6 +112,8 @@ namespace partition {
       throw std::runtime_error("Invalid format: File is incomplete (missing required sets)");
     }
     
+    PARTITION_METRICS_COUNT(kBytesParsed, bytes_parsed);
+    ThreeDMInstance instance = builder.Build();
     if (!instance.IsValid()) {
       throw std::runtime_error("Invalid instance: One or more sets do not match the specified size q");
     }
@@ -119,10 +130,51 @@ namespace partition {
            "- Line 5+: Triples, one per line as 'w x y'";
   }
 
-  auto ThreeDMReader::FillSetFromLine(std::istream& input, std::set<std::string>& elements, size_t q, const std::string& set_name) const -> void {
+  auto ThreeDMReader::ReadShapeFromFile(const std::string& filename)
+      -> ThreeDMShape {
+    std::ifstream file_stream(filename);
+    if (!file_stream.is_open()) {
+      throw std::runtime_error("Could not open file: " + filename);
+    }
+    return ReadShape(file_stream);
+  }
+
+  auto ThreeDMReader::ReadShape(std::istream& input) -> ThreeDMShape {
+    ThreeDMShape shape;
+    std::string line;
+    int line_number = 0;
+    size_t names = 0;
+    size_t name_bytes = 0;
+    while (std::getline(input, line)) {
+      auto end = std::min(line.find('#'), line.size());
+      if (line.find_first_not_of(" \t\r", 0) >= end) {
+        continue;
+      }
+      if (line_number == 0) {
+        shape.q = std::strtoull(line.c_str(), nullptr, 10);
+      } else if (line_number <= 3) {
+        std::istringstream line_stream(line.substr(0, end));
+        std::string element;
+        while (line_stream >> element) {
+          ++names;
+          name_bytes += element.size();
+        }
+      } else {
+        ++shape.k;
+      }
+      ++line_number;
+    }
+    if (shape.q == 0) {
+      throw std::runtime_error("Invalid format: q value must be a valid integer");
+    }
+    shape.name_length = names == 0 ? 0 : (name_bytes + names - 1) / names;
+    return shape;
+  }
+
+  auto ThreeDMReader::FillSetFromLine(std::istream& input, ThreeDMInstance::ElementSet& elements, size_t q, const std::string& set_name) const -> void {
     std::string element;
     while (input >> element) {
-      elements.insert(element);
+      elements.emplace(element);
     }
     if (elements.empty()) {
       throw std::runtime_error("Invalid format: " + set_name + " set cannot be empty");
@@ -11,6 +11,7 @@
 
 #include "io/three_d_m_writer.h"
 #include "core/three_d_m_instance.h"
+#include "util/metrics.h"
 
 #include <fstream>
 
@@ -24,6 +25,7 @@ namespace partition {
   }
 
   auto ThreeDMWriter::WriteToStream(const ThreeDMInstance& instance, std::ostream& output) const -> void {
+    PARTITION_METRICS_PHASE(kWrite);
     output << "W " << instance.w().size() << "\n";
     for (const auto& w_elem : instance.w()) {
       output << w_elem << " ";
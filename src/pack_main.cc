@@ -0,0 +1,139 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Creates, extends and inspects instance pack files.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/instance_pack_reader.h"
+#include "io/instance_pack_writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== INSTANCE PACK TOOL ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " create <pack> <dir> [-t 3dm|partition]" << std::endl;
+  std::cout << "  " << programName << " append <pack> <file>... [-t 3dm|partition]" << std::endl;
+  std::cout << "  " << programName << " list <pack>" << std::endl;
+  std::cout << "  " << programName << " verify <pack>" << std::endl;
+  std::cout << "  " << programName << " extract <pack> <name>" << std::endl << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "  -t <type>   Type of the text instances (default: 3dm). Binary 3DM" << std::endl;
+  std::cout << "              files are detected automatically." << std::endl;
+  std::cout << "  -h, --help  Show this help message" << std::endl << std::endl;
+}
+
+/**
+ * @brief Entry kind of a file: binary 3DM by its magic, else the text type.
+ */
+partition::PackEntryKind DetectKind(const std::string& path, partition::PackEntryKind text_kind) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[4];
+  if (file.read(magic, sizeof(magic)) && std::memcmp(magic, "3DMB", sizeof(magic)) == 0) {
+    return partition::PackEntryKind::kThreeDMBinary;
+  }
+  return text_kind;
+}
+
+int main(int argc, char* argv[]) {
+  auto text_kind = partition::PackEntryKind::kThreeDMText;
+  std::vector<std::string> arguments;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((std::strcmp(argv[i], "-h") == 0) || (std::strcmp(argv[i], "--help") == 0)) {
+      PrintHelp(argv[0]);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      std::string type = argv[++i];
+      if (type == "3dm") {
+        text_kind = partition::PackEntryKind::kThreeDMText;
+      } else if (type == "partition") {
+        text_kind = partition::PackEntryKind::kPartitionText;
+      } else {
+        std::cerr << "Unknown instance type: " << type << std::endl;
+        return 1;
+      }
+    } else {
+      arguments.emplace_back(argv[i]);
+    }
+  }
+  if (arguments.size() < 2) {
+    PrintHelp(argv[0]);
+    return 1;
+  }
+  const auto& command = arguments[0];
+  const auto& pack = arguments[1];
+
+  try {
+    if (command == "create" && arguments.size() == 3) {
+      std::vector<std::filesystem::path> files;
+      for (const auto& entry : std::filesystem::directory_iterator(arguments[2])) {
+        if (entry.is_regular_file()) {
+          files.push_back(entry.path());
+        }
+      }
+      std::sort(files.begin(), files.end());
+      partition::InstancePackWriter writer(pack);
+      for (const auto& file : files) {
+        writer.AddFile(file.filename().string(), DetectKind(file.string(), text_kind), file.string());
+      }
+      writer.Finish();
+      std::cout << "Packed " << writer.size() << " instances into " << pack << std::endl;
+    } else if (command == "append" && arguments.size() >= 3) {
+      partition::InstancePackWriter writer(pack, partition::InstancePackWriter::Mode::kAppend);
+      for (size_t i = 2; i < arguments.size(); ++i) {
+        auto name = std::filesystem::path(arguments[i]).filename().string();
+        writer.AddFile(name, DetectKind(arguments[i], text_kind), arguments[i]);
+      }
+      writer.Finish();
+      std::cout << pack << " now holds " << writer.size() << " instances" << std::endl;
+    } else if (command == "list") {
+      partition::InstancePackReader reader(pack);
+      for (const auto& entry : reader.entries()) {
+        std::cout << entry.name << "\t" << partition::PackEntryKindName(entry.kind) << "\t"
+                  << entry.offset << "\t" << entry.length << "\t" << std::hex << entry.hash
+                  << std::dec << std::endl;
+      }
+    } else if (command == "verify") {
+      partition::InstancePackReader reader(pack);
+      size_t corrupted = 0;
+      for (size_t i = 0; i < reader.size(); ++i) {
+        if (!reader.Verify(i)) {
+          std::cerr << reader.entry(i).name << ": hash mismatch" << std::endl;
+          ++corrupted;
+        }
+      }
+      std::cout << reader.size() - corrupted << "/" << reader.size() << " entries intact" << std::endl;
+      return corrupted == 0 ? 0 : 1;
+    } else if (command == "extract" && arguments.size() == 3) {
+      partition::InstancePackReader reader(pack);
+      auto index = reader.Find(arguments[2]);
+      if (!index) {
+        std::cerr << "No entry named " << arguments[2] << " in " << pack << std::endl;
+        return 1;
+      }
+      auto payload = reader.Payload(*index);
+      std::cout.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    } else {
+      PrintHelp(argv[0]);
+      return 1;
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
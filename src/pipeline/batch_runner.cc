@@ -0,0 +1,238 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for BatchRunner.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "pipeline/batch_runner.h"
+#include "io/instance_pack_reader.h"
+#include "io/reduced_partition_writer.h"
+#include "io/three_d_m_reader.h"
+#include "reduction/three_d_m_to_partition_reducer.h"
+#include "util/json_writer.h"
+#include "util/memory_accounting.h"
+#include "util/work_stealing_pool.h"
+
+#include <glob.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Initial size of each worker's parse arena.
+constexpr size_t kArenaBytes = size_t{1} << 20;
+
+auto MillisecondsSince(Clock::time_point start) -> double {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+/**
+ * @brief State a worker reuses for every instance it processes.
+ */
+struct WorkerState {
+  ThreeDMToPartitionReducer reducer;
+  std::vector<std::byte> arena = std::vector<std::byte>(kArenaBytes);
+};
+
+}  // namespace
+
+BatchRunner::BatchRunner(BatchOptions options)
+    : options_(std::move(options)) {}
+
+auto BatchRunner::Run(const std::vector<std::string>& inputs,
+                      std::ostream& records) -> BatchSummary {
+  return Execute(
+      inputs,
+      [&inputs](size_t index, std::pmr::memory_resource* resource) {
+        return ThreeDMReader(resource).ReadFromFile(inputs[index]);
+      },
+      [&inputs](size_t index) {
+        return ThreeDMReader::ReadShapeFromFile(inputs[index]);
+      },
+      records);
+}
+
+auto BatchRunner::Run(const InstancePackReader& pack, std::ostream& records)
+    -> BatchSummary {
+  std::vector<std::string> names;
+  names.reserve(pack.size());
+  for (const auto& entry : pack.entries()) {
+    names.push_back(entry.name);
+  }
+  return Execute(
+      names,
+      [&pack](size_t index, std::pmr::memory_resource* resource) {
+        return pack.ReadThreeDM(index, resource);
+      },
+      [&pack](size_t index) { return pack.ReadThreeDMShape(index); },
+      records);
+}
+
+auto BatchRunner::Execute(const std::vector<std::string>& inputs,
+                          const Loader& load, const ShapeReader& read_shape,
+                          std::ostream& records) -> BatchSummary {
+  auto batch_start = Clock::now();
+  std::filesystem::create_directories(options_.output_dir);
+  WorkStealingPool pool(options_.threads);
+  std::vector<WorkerState> workers(pool.size());
+  MemoryBudget budget(options_.memory_budget);
+  std::mutex records_mutex;
+  BatchSummary summary;
+
+  for (size_t index = 0; index < inputs.size(); ++index) {
+    pool.Submit([&, index](size_t worker) {
+      auto& state = workers[worker];
+      const auto& input = inputs[index];
+      auto stem = std::filesystem::path(input).stem().string();
+      auto output = (std::filesystem::path(options_.output_dir) /
+                     (std::to_string(index) + "-" + stem + ".partition.txt"))
+                        .string();
+      JsonObjectWriter record;
+      record.Add("index", index).Add("input", input);
+
+      auto start = Clock::now();
+      double read_ms = 0.0;
+      double reduce_ms = 0.0;
+      double write_ms = 0.0;
+      size_t reservation = 0;
+      bool succeeded = false;
+      bool refused = false;
+      try {
+        if (budget.limit() != 0) {
+          auto estimate = EstimateJobMemory(read_shape(index));
+          record.Add("estimate_bytes", estimate);
+          if (!budget.Acquire(estimate)) {
+            refused = true;
+            throw std::length_error(
+                "Estimated " + std::to_string(estimate) +
+                " bytes exceed the memory budget of " +
+                std::to_string(budget.limit()));
+          }
+          reservation = estimate;
+          start = Clock::now();
+        }
+        // Counted twice: what the structures hold, and what the arena had
+        // to take from the system beyond the worker's buffer.
+        CountingMemoryResource system;
+        std::pmr::monotonic_buffer_resource arena(
+            state.arena.data(), state.arena.size(), &system);
+        CountingMemoryResource held(&arena);
+        auto three_dm = load(index, &held);
+        read_ms = MillisecondsSince(start);
+        auto read_peak = held.peak_bytes();
+
+        auto phase_start = Clock::now();
+        held.ResetPeak();
+        auto reduced = state.reducer.ReduceCompact(three_dm);
+        reduce_ms = MillisecondsSince(phase_start);
+        auto reduce_peak = held.peak_bytes();
+
+        phase_start = Clock::now();
+        ReducedPartitionWriter().WriteToFile(reduced, output);
+        write_ms = MillisecondsSince(phase_start);
+
+        record.Add("status", "ok")
+            .Add("output", output)
+            .Add("q", three_dm.q())
+            .Add("triples", three_dm.triples().size())
+            .Add("elements", reduced.size())
+            .Add("bit_width", reduced.bit_width())
+            .Add("instance_bytes", three_dm.MemoryFootprint())
+            .Add("reduced_bytes", reduced.MemoryFootprint())
+            .Add("index_bytes", state.reducer.IndexMemoryFootprint())
+            .Add("read_peak_bytes", read_peak)
+            .Add("reduce_peak_bytes", reduce_peak)
+            .Add("arena_bytes", state.arena.size() + system.peak_bytes());
+        succeeded = true;
+      } catch (const std::exception& e) {
+        record.Add("status", refused ? "refused" : "error")
+            .Add("error", e.what());
+      }
+      if (reservation != 0) {
+        budget.Release(reservation);
+      }
+      record.Add("peak_rss_bytes", PeakResidentBytes())
+          .Add("read_ms", read_ms)
+          .Add("reduce_ms", reduce_ms)
+          .Add("write_ms", write_ms)
+          .Add("total_ms", MillisecondsSince(start));
+
+      auto line = record.ToString();
+      line += '\n';
+      std::lock_guard<std::mutex> lock(records_mutex);
+      records << line << std::flush;
+      ++(succeeded ? summary.succeeded
+                   : (refused ? summary.refused : summary.failed));
+    });
+  }
+  pool.WaitIdle();
+  summary.wall_ms = MillisecondsSince(batch_start);
+  summary.peak_rss_bytes = PeakResidentBytes();
+  return summary;
+}
+
+auto BatchRunner::EstimateJobMemory(const ThreeDMShape& shape) -> size_t {
+  // A triple list grown by doubling leaves up to one full copy behind in
+  // the monotonic arena and may end at twice the needed capacity.
+  size_t handed_out =
+      ThreeDMInstance::EstimateFootprint(shape) +
+      2 * shape.k * sizeof(Triple) +
+      ReducedPartitionInstance::EstimateFootprint(shape.q, shape.k);
+  // The arena doubles each block it takes from the system, so it may hold
+  // up to twice what it hands out. The index maps live outside it.
+  return 2 * handed_out +
+         ThreeDMToPartitionReducer::EstimateIndexFootprint(shape.q);
+}
+
+auto BatchRunner::CollectInputs(const std::string& source,
+                                std::istream& manifest)
+    -> std::vector<std::string> {
+  std::vector<std::string> inputs;
+  if (source == "-") {
+    std::string line;
+    while (std::getline(manifest, line)) {
+      auto begin = line.find_first_not_of(" \t\r");
+      if (begin == std::string::npos || line[begin] == '#') {
+        continue;
+      }
+      auto end = line.find_last_not_of(" \t\r");
+      inputs.push_back(line.substr(begin, end - begin + 1));
+    }
+  } else if (std::filesystem::is_directory(source)) {
+    for (const auto& entry : std::filesystem::directory_iterator(source)) {
+      if (entry.is_regular_file()) {
+        inputs.push_back(entry.path().string());
+      }
+    }
+    std::sort(inputs.begin(), inputs.end());
+  } else {
+    glob_t matches{};
+    if (::glob(source.c_str(), 0, nullptr, &matches) == 0) {
+      for (size_t i = 0; i < matches.gl_pathc; ++i) {
+        inputs.emplace_back(matches.gl_pathv[i]);
+      }
+    }
+    ::globfree(&matches);
+  }
+  if (inputs.empty()) {
+    throw std::runtime_error("No instances found in batch source: " + source);
+  }
+  return inputs;
+}
+
+}  // namespace partition
@@ -0,0 +1,351 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ReductionPipeline.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "pipeline/reduction_pipeline.h"
+#include "pipeline/bounded_spsc_queue.h"
+#include "solvers/solution_verifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace partition {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+auto MillisecondsSince(Clock::time_point start) -> double {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+/**
+ * @brief State of one job as it travels through the stages.
+ */
+struct ReductionPipeline::WorkItem {
+  size_t index = 0;
+  PipelineJob job;
+  std::optional<ThreeDMInstance> three_dm;
+  std::optional<InfeasibilityCertificate> rejection;
+  std::optional<PartitionInstance> partition;
+  std::optional<std::set<std::string>> partition_solution;
+  std::optional<std::vector<Triple>> three_dm_solution;
+  /// Taken on the solver thread: an automatic solver names its last pick.
+  std::string solver_name;
+  std::string report;
+  std::string error;
+  JobTimings timings;
+};
+
+ReductionPipeline::ReductionPipeline(
+    std::shared_ptr<ReductionStrategy> reduction_strategy,
+    std::shared_ptr<InstanceReader<ThreeDMInstance>> three_dm_reader,
+    std::shared_ptr<InstanceWriter<PartitionInstance>> partition_writer,
+    std::shared_ptr<InstanceSolver<PartitionInstance, std::set<std::string>>>
+        partition_solver)
+    : reduction_strategy_(std::move(reduction_strategy)),
+      three_dm_reader_(std::move(three_dm_reader)),
+      partition_writer_(std::move(partition_writer)),
+      partition_solver_(std::move(partition_solver)) {}
+
+auto ReductionPipeline::Execute(const std::string& three_dm_file,
+                                const std::string& partition_output_file)
+    -> std::string {
+  WorkItem item;
+  item.job = {three_dm_file, partition_output_file};
+  ReadStage(item);
+  ReduceStage(item);
+  SolveStage(item);
+  WriteStage(item);
+  if (!item.error.empty()) {
+    throw std::runtime_error(item.error);
+  }
+  return item.report;
+}
+
+auto ReductionPipeline::ExecuteBatch(const std::vector<PipelineJob>& jobs,
+                                     size_t queue_capacity)
+    -> std::vector<PipelineResult> {
+  using Queue = BoundedSpscQueue<std::unique_ptr<WorkItem>>;
+  Queue read_to_reduce(queue_capacity);
+  Queue reduce_to_solve(queue_capacity);
+  Queue solve_to_write(queue_capacity);
+  stage_metrics_ = {{"read"}, {"reduce"}, {"solve"}, {"write"}};
+  std::vector<PipelineResult> results(jobs.size());
+  auto batch_start = Clock::now();
+
+  auto run_middle_stage = [this](Queue& input, Queue& output,
+                                 StageMetrics& metrics, auto stage) {
+    while (true) {
+      auto wait_start = Clock::now();
+      auto item = input.Pop();
+      metrics.starved_ms += MillisecondsSince(wait_start);
+      if (!item) {
+        break;
+      }
+      auto busy_start = Clock::now();
+      (this->*stage)(**item);
+      metrics.busy_ms += MillisecondsSince(busy_start);
+      ++metrics.jobs;
+      auto push_start = Clock::now();
+      output.Push(std::move(*item));
+      metrics.blocked_ms += MillisecondsSince(push_start);
+    }
+    output.Close();
+  };
+
+  std::thread reader([&] {
+    auto& metrics = stage_metrics_[0];
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      auto item = std::make_unique<WorkItem>();
+      item->index = i;
+      item->job = jobs[i];
+      auto busy_start = Clock::now();
+      ReadStage(*item);
+      metrics.busy_ms += MillisecondsSince(busy_start);
+      ++metrics.jobs;
+      auto push_start = Clock::now();
+      read_to_reduce.Push(std::move(item));
+      metrics.blocked_ms += MillisecondsSince(push_start);
+    }
+    read_to_reduce.Close();
+  });
+  std::thread reducer([&] {
+    run_middle_stage(read_to_reduce, reduce_to_solve, stage_metrics_[1],
+                     &ReductionPipeline::ReduceStage);
+  });
+  std::thread solver([&] {
+    run_middle_stage(reduce_to_solve, solve_to_write, stage_metrics_[2],
+                     &ReductionPipeline::SolveStage);
+  });
+  std::thread writer([&] {
+    auto& metrics = stage_metrics_[3];
+    while (true) {
+      auto wait_start = Clock::now();
+      auto item = solve_to_write.Pop();
+      metrics.starved_ms += MillisecondsSince(wait_start);
+      if (!item) {
+        break;
+      }
+      auto busy_start = Clock::now();
+      auto& work = **item;
+      WriteStage(work);
+      metrics.busy_ms += MillisecondsSince(busy_start);
+      ++metrics.jobs;
+      auto& result = results[work.index];
+      result.three_dm_file = work.job.three_dm_file;
+      result.partition_output_file = work.job.partition_output_file;
+      result.succeeded = work.error.empty();
+      result.rejection = std::move(work.rejection);
+      result.error = std::move(work.error);
+      result.report = std::move(work.report);
+      result.timings = work.timings;
+    }
+  });
+  reader.join();
+  reducer.join();
+  solver.join();
+  writer.join();
+  batch_wall_ms_ = MillisecondsSince(batch_start);
+  return results;
+}
+
+auto ReductionPipeline::PerformReduction(const ThreeDMInstance& three_dm)
+    -> PartitionInstance {
+  return reduction_strategy_->Reduce(three_dm);
+}
+
+auto ReductionPipeline::SolveAndMapBack(
+    const PartitionInstance& partition,
+    const ThreeDMInstance& original_three_dm)
+    -> std::optional<std::vector<Triple>> {
+  auto partition_solution = partition_solver_->Solve(partition);
+  if (!partition_solution) {
+    return std::nullopt;
+  }
+  return reduction_strategy_->MapSolutionBack(*partition_solution,
+                                              original_three_dm);
+}
+
+auto ReductionPipeline::GenerateStageReport() const -> std::string {
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(3);
+  report << "=== PIPELINE STAGE METRICS ===\n";
+  report << std::left << std::setw(8) << "stage" << std::right
+         << std::setw(8) << "jobs" << std::setw(14) << "busy ms"
+         << std::setw(14) << "ms/job" << std::setw(14) << "starved ms"
+         << std::setw(14) << "blocked ms" << "\n";
+  const StageMetrics* bottleneck = nullptr;
+  for (const auto& stage : stage_metrics_) {
+    double per_job = stage.jobs == 0 ? 0.0 : stage.busy_ms / stage.jobs;
+    report << std::left << std::setw(8) << stage.name << std::right
+           << std::setw(8) << stage.jobs << std::setw(14) << stage.busy_ms
+           << std::setw(14) << per_job << std::setw(14) << stage.starved_ms
+           << std::setw(14) << stage.blocked_ms << "\n";
+    if (bottleneck == nullptr || stage.busy_ms > bottleneck->busy_ms) {
+      bottleneck = &stage;
+    }
+  }
+  double sequential_ms = 0.0;
+  for (const auto& stage : stage_metrics_) {
+    sequential_ms += stage.busy_ms;
+  }
+  report << "Wall time: " << batch_wall_ms_ << " ms (sum of stages: "
+         << sequential_ms << " ms)\n";
+  if (bottleneck != nullptr && batch_wall_ms_ > 0.0) {
+    report << "Throughput: " << bottleneck->jobs * 1000.0 / batch_wall_ms_
+           << " jobs/s, bottleneck stage: " << bottleneck->name << "\n";
+  }
+  return report.str();
+}
+
+auto ReductionPipeline::ReadStage(WorkItem& item) -> void {
+  auto start = Clock::now();
+  try {
+    item.three_dm = three_dm_reader_->ReadFromFile(item.job.three_dm_file);
+  } catch (const std::exception& e) {
+    item.error = std::string("read: ") + e.what();
+  }
+  item.timings.read_ms = MillisecondsSince(start);
+}
+
+auto ReductionPipeline::ReduceStage(WorkItem& item) -> void {
+  if (!item.error.empty()) {
+    return;
+  }
+  auto start = Clock::now();
+  if (precheck_enabled_) {
+    try {
+      item.rejection = precheck_.Check(*item.three_dm);
+    } catch (const std::exception& e) {
+      item.error = std::string("precheck: ") + e.what();
+    }
+    item.timings.precheck_ms = MillisecondsSince(start);
+    if (item.rejection || !item.error.empty()) {
+      return;
+    }
+    start = Clock::now();
+  }
+  try {
+    item.partition = PerformReduction(*item.three_dm);
+  } catch (const std::exception& e) {
+    item.error = std::string("reduce: ") + e.what();
+  }
+  item.timings.reduce_ms = MillisecondsSince(start);
+}
+
+auto ReductionPipeline::SolveStage(WorkItem& item) -> void {
+  if (!item.error.empty() || item.rejection) {
+    return;
+  }
+  auto start = Clock::now();
+  try {
+    item.partition_solution = partition_solver_->Solve(*item.partition);
+    item.solver_name = partition_solver_->GetAlgorithmName();
+    if (item.partition_solution) {
+      item.three_dm_solution = reduction_strategy_->MapSolutionBack(
+          *item.partition_solution, *item.three_dm);
+    }
+  } catch (const std::exception& e) {
+    item.error = std::string("solve: ") + e.what();
+  }
+  item.timings.solve_ms = MillisecondsSince(start);
+}
+
+auto ReductionPipeline::WriteStage(WorkItem& item) -> void {
+  if (!item.error.empty()) {
+    return;
+  }
+  if (item.rejection) {
+    std::ostringstream report;
+    report << "=== REDUCTION PIPELINE REPORT ===\n";
+    report << "3DM instance: q = " << item.three_dm->q()
+           << ", |M| = " << item.three_dm->triples().size() << "\n";
+    report << "Rejected before reduction ("
+           << InfeasibilityCertificate::ReasonName(item.rejection->reason)
+           << "): " << item.rejection->explanation << "\n";
+    report << std::fixed << std::setprecision(3);
+    report << "Timings (ms): read " << item.timings.read_ms << ", precheck "
+           << item.timings.precheck_ms << "\n";
+    item.report = report.str();
+    item.three_dm.reset();
+    return;
+  }
+  auto start = Clock::now();
+  try {
+    partition_writer_->WriteToFile(*item.partition,
+                                   item.job.partition_output_file);
+  } catch (const std::exception& e) {
+    item.error = std::string("write: ") + e.what();
+    return;
+  }
+  item.timings.write_ms = MillisecondsSince(start);
+  item.report = GenerateReport(*item.three_dm, *item.partition,
+                               item.partition_solution,
+                               item.three_dm_solution, item.solver_name,
+                               item.timings);
+  // The instances are no longer needed; free them on this thread.
+  item.three_dm.reset();
+  item.partition.reset();
+}
+
+auto ReductionPipeline::GenerateReport(
+    const ThreeDMInstance& three_dm, const PartitionInstance& partition,
+    const std::optional<std::set<std::string>>& partition_solution,
+    const std::optional<std::vector<Triple>>& three_dm_solution,
+    const std::string& solver_name, const JobTimings& timings)
+    -> std::string {
+  std::ostringstream report;
+  report << "=== REDUCTION PIPELINE REPORT ===\n";
+  report << "3DM instance: q = " << three_dm.q()
+         << ", |M| = " << three_dm.triples().size() << "\n";
+  report << "Reduction: " << reduction_strategy_->GetDescription() << "\n";
+  report << "Partition instance: " << partition.size()
+         << " elements, total sum = " << partition.total_sum() << "\n";
+  report << "Solver: " << solver_name << "\n";
+  if (partition_solution) {
+    bool partition_valid =
+        SolutionVerifier::VerifyPartitionSolution(partition,
+                                                  *partition_solution);
+    report << "Partition solution: found (" << partition_solution->size()
+           << " elements, " << (partition_valid ? "VALID" : "INVALID")
+           << ")\n";
+  } else {
+    report << "Partition solution: none\n";
+  }
+  if (three_dm_solution) {
+    bool matching_valid =
+        SolutionVerifier::Verify3DMSolution(three_dm, *three_dm_solution);
+    report << "3DM matching (" << (matching_valid ? "VALID" : "INVALID")
+           << "):";
+    for (const auto& triple : *three_dm_solution) {
+      report << " " << triple.ToString();
+    }
+    report << "\n";
+  } else {
+    report << "3DM matching: none\n";
+  }
+  report << std::fixed << std::setprecision(3);
+  report << "Timings (ms): read " << timings.read_ms
+         << ", precheck " << timings.precheck_ms
+         << ", reduce " << timings.reduce_ms
+         << ", solve " << timings.solve_ms
+         << ", write " << timings.write_ms << "\n";
+  return report.str();
+}
+
+}  // namespace partition
@@ -0,0 +1,173 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Runs many 3DM instances through the staged reduction pipeline.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "io/partition_writer.h"
+#include "io/three_d_m_reader.h"
+#include "pipeline/reduction_pipeline.h"
+#include "reduction/three_d_m_to_partition_reducer.h"
+#include "solvers/partition_solver.h"
+#include "solvers/solver_cost_model.h"
+#include "util/metrics.h"
+
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+/**
+ * @brief Parses a whole decimal argument into value.
+ * @return false if the text is not a number that fits in size_t.
+ */
+auto ParseCount(const char* text, size_t& value) -> bool {
+  auto end = text + std::strlen(text);
+  auto [ptr, ec] = std::from_chars(text, end, value);
+  return ec == std::errc() && ptr == end && ptr != text;
+}
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== 3DM TO PARTITION PIPELINE ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " [options] <3dm_file>..." << std::endl << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "  -o <dir>    Directory for the Partition instances (default: .)" << std::endl;
+  std::cout << "  -a <algo>   Solver: auto (default), backtracking, dp, multiset, sumset or" << std::endl;
+  std::cout << "              greedy. auto picks one per instance with a cost model" << std::endl;
+  std::cout << "  --cost-model <file>  Cost model for auto, as written by bench -c" << std::endl;
+  std::cout << "  -j <n>      Threads per dynamic programming pass (default: 1; 0 uses" << std::endl;
+  std::cout << "              every core)" << std::endl;
+  std::cout << "  -c <n>      Jobs buffered between stages, at least 1 (default: "
+            << partition::ReductionPipeline::kDefaultQueueCapacity << ")" << std::endl;
+  std::cout << "  -q          Quiet: only print the stage metrics" << std::endl;
+  std::cout << "  --no-precheck  Reduce and solve even instances that fail the necessary" << std::endl;
+  std::cout << "              conditions (k >= q, coverage, Hall bounds)" << std::endl;
+  std::cout << "  --metrics <file>  Write phase timings and counters (JSON, or"
+            << " Prometheus text for *.prom)" << std::endl;
+  std::cout << "  -h, --help  Show this help message" << std::endl << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  std::string output_dir = ".";
+  auto algorithm = partition::PartitionSolver::Algorithm::kAuto;
+  std::string cost_model_file;
+  size_t dp_threads = 1;
+  size_t queue_capacity = partition::ReductionPipeline::kDefaultQueueCapacity;
+  bool quiet = false;
+  bool precheck = true;
+  std::string metrics_file;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((std::strcmp(argv[i], "-h") == 0) || (std::strcmp(argv[i], "--help") == 0)) {
+      PrintHelp(argv[0]);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_dir = argv[++i];
+    } else if (std::strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+      std::string name = argv[++i];
+      if (name == "dp") {
+        algorithm = partition::PartitionSolver::Algorithm::kDynamicProgramming;
+      } else if (name == "multiset") {
+        algorithm = partition::PartitionSolver::Algorithm::kMultisetDynamicProgramming;
+      } else if (name == "sumset") {
+        algorithm = partition::PartitionSolver::Algorithm::kSumsetConvolution;
+      } else if (name == "greedy") {
+        algorithm = partition::PartitionSolver::Algorithm::kGreedyHeuristic;
+      } else if (name == "backtracking") {
+        algorithm = partition::PartitionSolver::Algorithm::kBacktracking;
+      } else if (name == "auto") {
+        algorithm = partition::PartitionSolver::Algorithm::kAuto;
+      } else {
+        std::cerr << "Unknown algorithm: " << name << std::endl;
+        return 1;
+      }
+    } else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      if (!ParseCount(argv[++i], dp_threads)) {
+        std::cerr << "Invalid thread count: " << argv[i] << std::endl;
+        PrintHelp(argv[0]);
+        return 1;
+      }
+    } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      if (!ParseCount(argv[++i], queue_capacity) || queue_capacity == 0) {
+        std::cerr << "Invalid queue capacity (must be >= 1): " << argv[i]
+                  << std::endl;
+        PrintHelp(argv[0]);
+        return 1;
+      }
+    } else if (std::strcmp(argv[i], "-q") == 0) {
+      quiet = true;
+    } else if (std::strcmp(argv[i], "--no-precheck") == 0) {
+      precheck = false;
+    } else if (std::strcmp(argv[i], "--cost-model") == 0 && i + 1 < argc) {
+      cost_model_file = argv[++i];
+    } else if (std::strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+      metrics_file = argv[++i];
+    } else {
+      inputs.emplace_back(argv[i]);
+    }
+  }
+  if (inputs.empty()) {
+    PrintHelp(argv[0]);
+    return 1;
+  }
+
+  std::vector<partition::PipelineJob> jobs;
+  jobs.reserve(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto stem = std::filesystem::path(inputs[i]).stem().string();
+    auto output = std::filesystem::path(output_dir) /
+                  (std::to_string(i) + "-" + stem + ".partition.txt");
+    jobs.push_back({inputs[i], output.string()});
+  }
+
+  auto solver = std::make_shared<partition::PartitionSolver>(algorithm);
+  solver->SetDynamicProgrammingThreads(dp_threads);
+  if (!cost_model_file.empty()) {
+    try {
+      solver->SetCostModel(std::make_shared<partition::SolverCostModel>(
+          partition::SolverCostModel::LoadFromFile(cost_model_file)));
+    } catch (const std::exception& e) {
+      std::cerr << "ERROR: " << e.what() << std::endl;
+      return 1;
+    }
+  }
+  partition::ReductionPipeline pipeline(
+      std::make_shared<partition::ThreeDMToPartitionReducer>(),
+      std::make_shared<partition::ThreeDMReader>(),
+      std::make_shared<partition::PartitionWriter>(),
+      solver);
+  pipeline.SetPrecheckEnabled(precheck);
+  auto results = pipeline.ExecuteBatch(jobs, queue_capacity);
+
+  int exit_code = 0;
+  for (const auto& result : results) {
+    if (!result.succeeded) {
+      std::cerr << result.three_dm_file << ": ERROR: " << result.error << std::endl;
+      exit_code = 1;
+    } else if (!quiet && result.rejection) {
+      std::cout << result.three_dm_file << " rejected" << std::endl;
+      std::cout << result.report << std::endl;
+    } else if (!quiet) {
+      std::cout << result.three_dm_file << " -> " << result.partition_output_file << std::endl;
+      std::cout << result.report << std::endl;
+    }
+  }
+  std::cout << pipeline.GenerateStageReport();
+  if (!metrics_file.empty()) {
+    partition::MetricsRegistry::Global().WriteToFile(metrics_file);
+  }
+  return exit_code;
+}
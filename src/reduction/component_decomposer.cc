@@ -0,0 +1,121 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ComponentDecomposer.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "reduction/component_decomposer.h"
+#include "core/three_d_m_instance_builder.h"
+#include "core/triple_conflict_index.h"
+
+#include <array>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Union-find over dense ids with union by size and path halving.
+ */
+class DisjointSets {
+ public:
+  explicit DisjointSets(size_t count) : parent_(count), size_(count, 1) {
+    std::iota(parent_.begin(), parent_.end(), 0);
+  }
+
+  auto Find(uint32_t id) -> uint32_t {
+    while (parent_[id] != id) {
+      parent_[id] = parent_[parent_[id]];
+      id = parent_[id];
+    }
+    return id;
+  }
+
+  auto Union(uint32_t a, uint32_t b) -> void {
+    a = Find(a);
+    b = Find(b);
+    if (a == b) {
+      return;
+    }
+    if (size_[a] < size_[b]) {
+      std::swap(a, b);
+    }
+    parent_[b] = a;
+    size_[a] += size_[b];
+  }
+
+ private:
+  std::vector<uint32_t> parent_;
+  std::vector<uint32_t> size_;
+};
+
+}  // namespace
+
+ComponentDecomposer::ComponentDecomposer(size_t threads,
+                                         std::pmr::memory_resource* resource)
+    : threads_(threads), resource_(resource) {}
+
+auto ComponentDecomposer::Decompose(const ThreeDMInstance& instance) const
+    -> std::vector<ThreeDMComponent> {
+  TripleConflictIndex index(instance, threads_, 0);
+  DisjointSets sets(index.element_count());
+  for (size_t t = 0; t < index.triple_count(); ++t) {
+    const auto& coordinates = index.coordinates(t);
+    sets.Union(coordinates[0], coordinates[1]);
+    sets.Union(coordinates[0], coordinates[2]);
+  }
+
+  // Number the components by their first element and hand out the
+  // elements; the sets are walked in order, so every insert appends.
+  constexpr uint32_t kUnassigned = std::numeric_limits<uint32_t>::max();
+  using ElementSet = ThreeDMInstance::ElementSet;
+  std::vector<uint32_t> component_of_root(index.element_count(), kUnassigned);
+  std::vector<std::array<ElementSet, 3>> elements;
+  const ElementSet* element_sets[3] = {&instance.w(), &instance.x(),
+                                       &instance.y()};
+  uint32_t element = 0;
+  for (size_t set = 0; set < 3; ++set) {
+    for (const auto& name : *element_sets[set]) {
+      uint32_t root = sets.Find(element++);
+      if (component_of_root[root] == kUnassigned) {
+        component_of_root[root] = static_cast<uint32_t>(elements.size());
+        elements.push_back({ElementSet(resource_), ElementSet(resource_),
+                            ElementSet(resource_)});
+      }
+      auto& members = elements[component_of_root[root]][set];
+      members.emplace_hint(members.end(), name);
+    }
+  }
+
+  std::vector<std::vector<uint32_t>> triples_of(elements.size());
+  const auto& triples = instance.triples();
+  for (size_t t = 0; t < triples.size(); ++t) {
+    auto component = component_of_root[sets.Find(index.coordinates(t)[0])];
+    triples_of[component].push_back(static_cast<uint32_t>(t));
+  }
+  std::vector<ThreeDMComponent> components;
+  components.reserve(elements.size());
+  for (size_t c = 0; c < elements.size(); ++c) {
+    ThreeDMInstanceBuilder builder(resource_);
+    builder.Reserve(triples_of[c].size());
+    builder.SetQ(elements[c][0].size());
+    builder.SetW(std::move(elements[c][0]));
+    builder.SetX(std::move(elements[c][1]));
+    builder.SetY(std::move(elements[c][2]));
+    for (uint32_t t : triples_of[c]) {
+      builder.AddTriple(triples[t]);
+    }
+    components.push_back({builder.Build(), std::move(triples_of[c])});
+  }
+  return components;
+}
+
+}  // namespace partition
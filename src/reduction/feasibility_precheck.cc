@@ -0,0 +1,337 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for FeasibilityPrecheck.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "reduction/feasibility_precheck.h"
+#include "core/triple_conflict_index.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace partition {
+
+namespace {
+
+constexpr uint32_t kFree = std::numeric_limits<uint32_t>::max();
+constexpr const char* kSetNames[3] = {"W", "X", "Y"};
+/// Names listed in an explanation before it says "and N more".
+constexpr size_t kListedNames = 8;
+
+/**
+ * @brief Bipartite graph from one set of q elements to another, in CSR
+ * form, with a Hopcroft-Karp maximum matching.
+ */
+class BipartiteProjection {
+ public:
+  /**
+   * @brief Edges (a, b) for every triple, ids relative to their sets.
+   */
+  BipartiteProjection(const TripleConflictIndex& index, size_t from,
+                      size_t to)
+      : left_(index.set_size(from)), right_(index.set_size(to)) {
+    uint32_t from_base = SetBase(index, from);
+    uint32_t to_base = SetBase(index, to);
+    offsets_.assign(left_ + 1, 0);
+    for (size_t t = 0; t < index.triple_count(); ++t) {
+      ++offsets_[index.coordinates(t)[from] - from_base + 1];
+    }
+    for (size_t u = 0; u < left_; ++u) {
+      offsets_[u + 1] += offsets_[u];
+    }
+    std::vector<uint32_t> cursor(offsets_.begin(), offsets_.end() - 1);
+    edges_.resize(index.triple_count());
+    for (size_t t = 0; t < index.triple_count(); ++t) {
+      const auto& coordinates = index.coordinates(t);
+      edges_[cursor[coordinates[from] - from_base]++] =
+          coordinates[to] - to_base;
+    }
+    // Several triples project onto the same pair; keep one edge each.
+    uint32_t write = 0;
+    for (size_t u = 0; u < left_; ++u) {
+      auto begin = edges_.begin() + offsets_[u];
+      auto end = edges_.begin() + offsets_[u + 1];
+      std::sort(begin, end);
+      auto last = std::unique(begin, end);
+      offsets_[u] = write;
+      write = static_cast<uint32_t>(
+          std::copy(begin, last, edges_.begin() + write) - edges_.begin());
+    }
+    offsets_[left_] = write;
+    edges_.resize(write);
+  }
+
+  /**
+   * @return Size of a maximum matching.
+   */
+  auto MaximumMatching() -> size_t {
+    match_left_.assign(left_, kFree);
+    match_right_.assign(right_, kFree);
+    size_t matched = 0;
+    while (BuildLayers()) {
+      next_edge_.assign(offsets_.begin(), offsets_.end() - 1);
+      for (uint32_t root = 0; root < left_; ++root) {
+        if (match_left_[root] == kFree && Augment(root)) {
+          ++matched;
+        }
+      }
+    }
+    return matched;
+  }
+
+  /**
+   * @brief After MaximumMatching: left vertices reachable from unmatched
+   * ones by alternating paths, and their neighbours. With a deficient
+   * matching, |neighbours| < |set|.
+   */
+  auto DeficientSet(std::vector<uint32_t>& set,
+                    std::vector<uint32_t>& neighbours) const -> void {
+    std::vector<bool> seen_left(left_, false);
+    std::vector<bool> seen_right(right_, false);
+    for (uint32_t u = 0; u < left_; ++u) {
+      if (match_left_[u] == kFree) {
+        seen_left[u] = true;
+        set.push_back(u);
+      }
+    }
+    for (size_t i = 0; i < set.size(); ++i) {
+      uint32_t u = set[i];
+      for (uint32_t e = offsets_[u]; e < offsets_[u + 1]; ++e) {
+        uint32_t v = edges_[e];
+        if (seen_right[v]) {
+          continue;
+        }
+        seen_right[v] = true;
+        neighbours.push_back(v);
+        // Maximum, so every reachable right vertex is matched.
+        uint32_t w = match_right_[v];
+        if (w != kFree && !seen_left[w]) {
+          seen_left[w] = true;
+          set.push_back(w);
+        }
+      }
+    }
+  }
+
+  static auto SetBase(const TripleConflictIndex& index, size_t set)
+      -> uint32_t {
+    size_t base = 0;
+    for (size_t s = 0; s < set; ++s) {
+      base += index.set_size(s);
+    }
+    return static_cast<uint32_t>(base);
+  }
+
+ private:
+  /**
+   * @brief BFS layers from the free left vertices; true if some free
+   * right vertex is reachable.
+   */
+  auto BuildLayers() -> bool {
+    layer_.assign(left_, kFree);
+    std::vector<uint32_t> queue;
+    for (uint32_t u = 0; u < left_; ++u) {
+      if (match_left_[u] == kFree) {
+        layer_[u] = 0;
+        queue.push_back(u);
+      }
+    }
+    bool found = false;
+    for (size_t i = 0; i < queue.size(); ++i) {
+      uint32_t u = queue[i];
+      for (uint32_t e = offsets_[u]; e < offsets_[u + 1]; ++e) {
+        uint32_t w = match_right_[edges_[e]];
+        if (w == kFree) {
+          found = true;
+        } else if (layer_[w] == kFree) {
+          layer_[w] = layer_[u] + 1;
+          queue.push_back(w);
+        }
+      }
+    }
+    return found;
+  }
+
+  /**
+   * @brief Iterative DFS along the layers for an augmenting path from
+   * root; flips it if found. Dead ends leave the layering.
+   */
+  auto Augment(uint32_t root) -> bool {
+    stack_.assign(1, root);
+    while (!stack_.empty()) {
+      uint32_t u = stack_.back();
+      if (next_edge_[u] == offsets_[u + 1]) {
+        layer_[u] = kFree;
+        stack_.pop_back();
+        if (!stack_.empty()) {
+          ++next_edge_[stack_.back()];
+        }
+        continue;
+      }
+      uint32_t v = edges_[next_edge_[u]];
+      uint32_t w = match_right_[v];
+      if (w == kFree) {
+        // Every vertex on the stack takes the edge it is looking at.
+        for (uint32_t on_path : stack_) {
+          uint32_t target = edges_[next_edge_[on_path]];
+          match_left_[on_path] = target;
+          match_right_[target] = on_path;
+        }
+        return true;
+      }
+      if (layer_[w] != kFree && layer_[w] == layer_[u] + 1) {
+        stack_.push_back(w);
+      } else {
+        ++next_edge_[u];
+      }
+    }
+    return false;
+  }
+
+  size_t left_;
+  size_t right_;
+  std::vector<uint32_t> offsets_;
+  std::vector<uint32_t> edges_;
+  std::vector<uint32_t> match_left_;
+  std::vector<uint32_t> match_right_;
+  std::vector<uint32_t> layer_;
+  std::vector<uint32_t> next_edge_;
+  std::vector<uint32_t> stack_;
+};
+
+/**
+ * @brief "{a, b, c and 5 more}" for the named elements.
+ */
+auto ListNames(const std::vector<std::string>& names) -> std::string {
+  std::string list = "{";
+  for (size_t i = 0; i < names.size() && i < kListedNames; ++i) {
+    if (i > 0) {
+      list += ", ";
+    }
+    list += names[i];
+  }
+  if (names.size() > kListedNames) {
+    list += " and " + std::to_string(names.size() - kListedNames) + " more";
+  }
+  return list + "}";
+}
+
+}  // namespace
+
+auto InfeasibilityCertificate::ReasonName(Reason reason) -> const char* {
+  switch (reason) {
+    case Reason::kUnequalSets:
+      return "unequal_sets";
+    case Reason::kTooFewTriples:
+      return "too_few_triples";
+    case Reason::kUncoveredElement:
+      return "uncovered_element";
+    case Reason::kHallViolation:
+      return "hall_violation";
+  }
+  return "unknown";
+}
+
+FeasibilityPrecheck::FeasibilityPrecheck(size_t threads)
+    : threads_(threads) {}
+
+auto FeasibilityPrecheck::Check(const ThreeDMInstance& instance) const
+    -> std::optional<InfeasibilityCertificate> {
+  using Reason = InfeasibilityCertificate::Reason;
+  size_t q = instance.q();
+  if (!instance.IsValid()) {
+    return InfeasibilityCertificate{
+        Reason::kUnequalSets,
+        "|W| = " + std::to_string(instance.w().size()) +
+            ", |X| = " + std::to_string(instance.x().size()) +
+            ", |Y| = " + std::to_string(instance.y().size()) +
+            ", but q = " + std::to_string(q),
+        {}};
+  }
+  size_t k = instance.triples().size();
+  if (k < q) {
+    return InfeasibilityCertificate{
+        Reason::kTooFewTriples,
+        "Only " + std::to_string(k) + " triples for q = " +
+            std::to_string(q) + " disjoint ones",
+        {}};
+  }
+
+  TripleConflictIndex index(instance, threads_, 0);
+  std::vector<std::string_view> names;
+  names.reserve(index.element_count());
+  for (const auto* set : {&instance.w(), &instance.x(), &instance.y()}) {
+    names.insert(names.end(), set->begin(), set->end());
+  }
+  for (uint32_t element = 0; element < index.element_count(); ++element) {
+    if (index.TriplesWith(element).empty()) {
+      std::string name(names[element]);
+      return InfeasibilityCertificate{
+          Reason::kUncoveredElement,
+          "Element " + name + " of " + kSetNames[element / q] +
+              " is in no triple",
+          {name}};
+    }
+  }
+
+  // The three projections are independent; the first failing pair in
+  // W-X, W-Y, X-Y order gives the certificate.
+  constexpr std::array<std::array<size_t, 2>, 3> kPairs = {
+      {{0, 1}, {0, 2}, {1, 2}}};
+  std::array<std::optional<InfeasibilityCertificate>, 3> results;
+  ParallelFor(kPairs.size(), threads_, [&](size_t begin, size_t end) {
+    for (size_t pair = begin; pair < end; ++pair) {
+      auto [from, to] = kPairs[pair];
+      BipartiteProjection projection(index, from, to);
+      size_t matched = projection.MaximumMatching();
+      if (matched == q) {
+        continue;
+      }
+      std::vector<uint32_t> set;
+      std::vector<uint32_t> neighbours;
+      projection.DeficientSet(set, neighbours);
+      uint32_t from_base = BipartiteProjection::SetBase(index, from);
+      uint32_t to_base = BipartiteProjection::SetBase(index, to);
+      std::vector<std::string> set_names;
+      for (uint32_t u : set) {
+        set_names.emplace_back(names[from_base + u]);
+      }
+      std::vector<std::string> neighbour_names;
+      for (uint32_t v : neighbours) {
+        neighbour_names.emplace_back(names[to_base + v]);
+      }
+      std::sort(set_names.begin(), set_names.end());
+      std::sort(neighbour_names.begin(), neighbour_names.end());
+      std::string explanation =
+          std::string("Hall violation on ") + kSetNames[from] + "-" +
+          kSetNames[to] + ": the " + std::to_string(set_names.size()) +
+          " elements " + ListNames(set_names) + " of " + kSetNames[from] +
+          " share triples with only " +
+          std::to_string(neighbour_names.size()) + " elements " +
+          ListNames(neighbour_names) + " of " + kSetNames[to] +
+          " (maximum matching " + std::to_string(matched) + " < q = " +
+          std::to_string(q) + ")";
+      results[pair] = InfeasibilityCertificate{
+          Reason::kHallViolation, std::move(explanation),
+          std::move(set_names)};
+    }
+  });
+  for (auto& result : results) {
+    if (result) {
+      return std::move(result);
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace partition
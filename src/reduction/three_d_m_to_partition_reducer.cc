@@ -10,44 +10,86 @@
  */
 
 #include "reduction/three_d_m_to_partition_reducer.h"
+#include "core/partition_instance_builder.h"
+#include "util/metrics.h"
 
 #include <cmath>
-#include <iostream>
+#include <stdexcept>
 
 namespace partition {
 
+namespace {
+
+/// One index map node: next pointer, key, value and the cached hash.
+constexpr size_t kIndexNodeBytes =
+    sizeof(void*) + sizeof(std::pair<const std::string_view, size_t>) +
+    sizeof(size_t);
+
+auto IndexMapFootprint(
+    const std::unordered_map<std::string_view, size_t>& indices) -> size_t {
+  return indices.bucket_count() * sizeof(void*) +
+         indices.size() * kIndexNodeBytes;
+}
+
+}  // namespace
+
 auto ThreeDMToPartitionReducer::Reduce(const ThreeDMInstance& three_dm) const
     -> PartitionInstance {
-  PartitionInstance partition_instance;
+  // The reduced instance shares the memory resource of the 3DM instance so
+  // a whole job can live in a single arena.
+  PartitionInstanceBuilder builder(three_dm.get_allocator().resource());
   q_ = three_dm.q();
   auto k = three_dm.triples().size();
-  auto elements = std::vector<PartitionElement>{};
   p_ = std::ceil(std::log2(k + 1));
+  if (3 * q_ * p_ + 2 > 63) {
+    throw std::overflow_error(
+        "Reduced sizes need " + std::to_string(3 * q_ * p_ + 2) +
+        " bits, which does not fit in a PartitionInstance");
+  }
   // create index maps
   CreateIndexMaps(three_dm);
+  PARTITION_METRICS_PHASE(kWeights);
+  PARTITION_METRICS_COUNT(kTriplesReduced, k);
+  builder.Reserve(k + 2);
   for (size_t i{0}; i < k; ++i) {
-    elements.push_back(PartitionElement(
-        "a_" + std::to_string(i), CalculateWeight(three_dm.triples()[i])));
-  }
-  auto total_weight = uint64_t{0};
-  for (const auto& element : elements) {
-    total_weight += element.size();
+    builder.EmplaceElement("a_" + std::to_string(i),
+                           CalculateWeight(three_dm.triples()[i]));
   }
+  auto total_weight = static_cast<uint64_t>(builder.total_sum());
   auto B = CalculateB();
   auto b1 = 2 * total_weight - B;
   auto b2 = total_weight + B;
-  elements.push_back(PartitionElement("b1", b1));
-  elements.push_back(PartitionElement("b2", b2));
-  partition_instance.SetElements(elements);
-  partition_instance.SetBinaryDisplayWidth(3 * q_ * p_);
-  return partition_instance;
+  builder.EmplaceElement("b1", b1);
+  builder.EmplaceElement("b2", b2);
+  builder.SetBinaryDisplayWidth(3 * q_ * p_);
+  return builder.Build();
+}
+
+auto ThreeDMToPartitionReducer::ReduceCompact(
+    const ThreeDMInstance& three_dm) const -> ReducedPartitionInstance {
+  q_ = three_dm.q();
+  auto k = three_dm.triples().size();
+  p_ = std::ceil(std::log2(k + 1));
+  CreateIndexMaps(three_dm);
+  PARTITION_METRICS_PHASE(kWeights);
+  PARTITION_METRICS_COUNT(kTriplesReduced, k);
+  ReducedPartitionInstance reduced(q_, p_, three_dm.get_allocator());
+  reduced.Reserve(k);
+  for (const auto& triple : three_dm.triples()) {
+    reduced.AddTriplePositions(CalculatePositions(triple));
+  }
+  return reduced;
 }
 
 auto ThreeDMToPartitionReducer::CreateIndexMaps(
     const ThreeDMInstance& three_dm) const -> void {
+  PARTITION_METRICS_PHASE(kIndexMap);
   w_indices_.clear();
   x_indices_.clear();
   y_indices_.clear();
+  w_indices_.reserve(three_dm.w().size());
+  x_indices_.reserve(three_dm.x().size());
+  y_indices_.reserve(three_dm.y().size());
 
   size_t index = 1;
   for (const auto& w_elem : three_dm.w()) {
@@ -67,13 +109,18 @@ auto ThreeDMToPartitionReducer::CreateIndexMaps(
 
 auto ThreeDMToPartitionReducer::CalculateWeight(const Triple& triple) const
     -> uint64_t {
+  auto positions = CalculatePositions(triple);
+  return Pow2(positions[0]) + Pow2(positions[1]) + Pow2(positions[2]);
+}
+
+auto ThreeDMToPartitionReducer::CalculatePositions(const Triple& triple) const
+    -> ReducedPartitionInstance::Positions {
   auto w_index = w_indices_.at(triple.w());
   auto x_index = x_indices_.at(triple.x());
   auto y_index = y_indices_.at(triple.y());
-  auto w_part = Pow2(2 * q_ * p_ + p_ * (q_ - w_index));
-  auto x_part = Pow2(q_ * p_ + p_ * (q_ - x_index));
-  auto y_part = Pow2(p_ * (q_ - y_index));
-  return w_part + x_part + y_part;
+  return {static_cast<uint32_t>(2 * q_ * p_ + p_ * (q_ - w_index)),
+          static_cast<uint32_t>(q_ * p_ + p_ * (q_ - x_index)),
+          static_cast<uint32_t>(p_ * (q_ - y_index))};
 }
 
 auto ThreeDMToPartitionReducer::CalculateB() const -> uint64_t {
@@ -82,17 +129,29 @@ auto ThreeDMToPartitionReducer::CalculateB() const -> uint64_t {
   for (size_t i{0}; i <= upper; ++i) {
     B += Pow2(p_ * i);
   }
-  std::cout << "B: " << B << std::endl;
   return B;
 }
 
 auto ThreeDMToPartitionReducer::MapSolutionBack(
     const std::set<std::string>& partition_solution,
     const ThreeDMInstance& original_instance) const -> std::vector<Triple> {
+  // The side holding b1 contains exactly the triples of the matching; the
+  // side holding b2 contains the rest. Only the arguments are used, so this
+  // is safe to call while another thread runs Reduce.
+  PARTITION_METRICS_PHASE(kMapBack);
   std::vector<Triple> matching;
-  // TODO: Implement reverse mapping from partition solution to 3DM matching
-  (void)partition_solution;
-  (void)original_instance;
+  const auto& triples = original_instance.triples();
+  bool has_b1 = partition_solution.count("b1") != 0;
+  bool has_b2 = partition_solution.count("b2") != 0;
+  if (has_b1 == has_b2) {
+    return matching;
+  }
+  for (size_t i{0}; i < triples.size(); ++i) {
+    bool in_solution = partition_solution.count("a_" + std::to_string(i)) != 0;
+    if (in_solution == has_b1) {
+      matching.push_back(triples[i]);
+    }
+  }
   return matching;
 }
 
@@ -100,4 +159,14 @@ auto ThreeDMToPartitionReducer::GetDescription() const -> std::string {
   return "3D-Matching to Partition reduction strategy";
 }
 
+auto ThreeDMToPartitionReducer::IndexMemoryFootprint() const -> size_t {
+  return IndexMapFootprint(w_indices_) + IndexMapFootprint(x_indices_) +
+         IndexMapFootprint(y_indices_);
+}
+
+auto ThreeDMToPartitionReducer::EstimateIndexFootprint(size_t q) -> size_t {
+  // reserve(q) rounds the bucket count up to a prime, at most about 2q.
+  return 3 * (2 * q * sizeof(void*) + q * kIndexNodeBytes);
+}
+
 }  // namespace partition
\ No newline at end of file
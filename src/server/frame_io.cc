@@ -0,0 +1,108 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the length-prefixed frame protocol.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "server/frame_io.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Reads exactly size bytes.
+ * @return Number of bytes read; less than size only at end of stream.
+ */
+auto ReadFully(int fd, char* data, size_t size) -> size_t {
+  size_t done = 0;
+  while (done < size) {
+    auto result = ::read(fd, data + done, size - done);
+    if (result == 0) {
+      break;
+    }
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(std::string("read failed: ") +
+                               std::strerror(errno));
+    }
+    done += static_cast<size_t>(result);
+  }
+  return done;
+}
+
+auto WriteFully(int fd, const char* data, size_t size) -> void {
+  size_t done = 0;
+  while (done < size) {
+    auto result = ::send(fd, data + done, size - done, MSG_NOSIGNAL);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(std::string("write failed: ") +
+                               std::strerror(errno));
+    }
+    done += static_cast<size_t>(result);
+  }
+}
+
+}  // namespace
+
+auto ReadFrame(int fd, Frame& frame) -> bool {
+  unsigned char header[8];
+  auto got = ReadFully(fd, reinterpret_cast<char*>(header), sizeof(header));
+  if (got == 0) {
+    return false;
+  }
+  if (got != sizeof(header)) {
+    throw std::runtime_error("truncated frame header");
+  }
+  uint32_t length = static_cast<uint32_t>(header[4]) << 24 |
+                    static_cast<uint32_t>(header[5]) << 16 |
+                    static_cast<uint32_t>(header[6]) << 8 |
+                    static_cast<uint32_t>(header[7]);
+  if (length > kMaxFramePayload) {
+    throw std::runtime_error("frame payload too large: " +
+                             std::to_string(length));
+  }
+  frame.type = static_cast<FrameType>(header[0]);
+  frame.payload.resize(length);
+  if (ReadFully(fd, frame.payload.data(), length) != length) {
+    throw std::runtime_error("truncated frame payload");
+  }
+  return true;
+}
+
+auto WriteFrame(int fd, FrameType type, std::string_view payload) -> void {
+  if (payload.size() > kMaxFramePayload) {
+    throw std::runtime_error("frame payload too large: " +
+                             std::to_string(payload.size()));
+  }
+  auto length = static_cast<uint32_t>(payload.size());
+  const char header[8] = {static_cast<char>(type),
+                          0,
+                          0,
+                          0,
+                          static_cast<char>((length >> 24) & 0xFF),
+                          static_cast<char>((length >> 16) & 0xFF),
+                          static_cast<char>((length >> 8) & 0xFF),
+                          static_cast<char>(length & 0xFF)};
+  WriteFully(fd, header, sizeof(header));
+  WriteFully(fd, payload.data(), payload.size());
+}
+
+}  // namespace partition
@@ -0,0 +1,314 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ReductionServer.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "server/reduction_server.h"
+#include "io/partition_reader.h"
+#include "io/reduced_partition_writer.h"
+#include "io/three_d_m_binary_reader.h"
+#include "io/three_d_m_reader.h"
+#include "reduction/three_d_m_to_partition_reducer.h"
+#include "solvers/component_solver.h"
+#include "util/memory_stream.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace partition {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Initial size of each worker's parse arena.
+constexpr size_t kArenaBytes = size_t{1} << 20;
+
+/// How often the accept loop checks the stop flag.
+constexpr int kAcceptPollMs = 200;
+
+auto MillisecondsSince(Clock::time_point start) -> double {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+/**
+ * @brief State a worker keeps warm between requests.
+ *
+ * The reducer caches its index maps and the solvers their scratch vectors,
+ * so reusing them avoids rebuilding that state per request. The arena
+ * backs a fresh monotonic resource for every request and grows to the
+ * largest request seen.
+ */
+struct ReductionServer::WorkerState {
+  explicit WorkerState(const ServerOptions& options)
+      : partition_solver(options.algorithm), arena(kArenaBytes) {
+    partition_solver.SetCostModel(options.cost_model);
+  }
+
+  ThreeDMToPartitionReducer reducer;
+  // One thread per request: the server already runs requests in parallel.
+  ComponentSolver component_solver{1};
+  PartitionSolver partition_solver;
+  std::vector<std::byte> arena;
+};
+
+/**
+ * @brief An accepted client and the thread serving it.
+ */
+struct ReductionServer::Connection {
+  int fd = -1;
+  std::thread thread;
+  std::atomic<bool> done{false};
+};
+
+ReductionServer::ReductionServer(ServerOptions options)
+    : options_(std::move(options)), pool_(options_.threads) {
+  workers_.reserve(pool_.size());
+  for (size_t i = 0; i < pool_.size(); ++i) {
+    workers_.push_back(std::make_unique<WorkerState>(options_));
+  }
+}
+
+ReductionServer::~ReductionServer() {
+  Stop();
+  ReapConnections(true);
+}
+
+auto ReductionServer::Run() -> void {
+  if (options_.socket_path.size() >= sizeof(sockaddr_un::sun_path)) {
+    throw std::runtime_error("Socket path too long: " + options_.socket_path);
+  }
+  int listen_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (listen_fd < 0) {
+    throw std::runtime_error(std::string("socket failed: ") +
+                             std::strerror(errno));
+  }
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, options_.socket_path.c_str(),
+               sizeof(address.sun_path) - 1);
+  ::unlink(options_.socket_path.c_str());
+  if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&address),
+             sizeof(address)) < 0 ||
+      ::listen(listen_fd, SOMAXCONN) < 0) {
+    auto error = std::string("Cannot listen on ") + options_.socket_path +
+                 ": " + std::strerror(errno);
+    ::close(listen_fd);
+    throw std::runtime_error(error);
+  }
+
+  while (!stopping_.load()) {
+    pollfd waiting{listen_fd, POLLIN, 0};
+    int ready = ::poll(&waiting, 1, kAcceptPollMs);
+    ReapConnections(false);
+    if (ready <= 0) {
+      continue;
+    }
+    int client_fd = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (client_fd < 0) {
+      continue;
+    }
+    auto connection = std::make_unique<Connection>();
+    connection->fd = client_fd;
+    auto* raw = connection.get();
+    connection->thread = std::thread([this, raw] { ServeConnection(*raw); });
+    connections_.push_back(std::move(connection));
+  }
+
+  ::close(listen_fd);
+  ::unlink(options_.socket_path.c_str());
+  ReapConnections(true);
+}
+
+auto ReductionServer::ReapConnections(bool all) -> void {
+  for (auto it = connections_.begin(); it != connections_.end();) {
+    auto& connection = **it;
+    if (all && !connection.done.load()) {
+      // Wake a reader blocked on an idle client.
+      ::shutdown(connection.fd, SHUT_RDWR);
+    }
+    if (all || connection.done.load()) {
+      connection.thread.join();
+      ::close(connection.fd);
+      it = connections_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+auto ReductionServer::ServeConnection(Connection& connection) -> void {
+  try {
+    Frame request;
+    while (!stopping_.load() && ReadFrame(connection.fd, request)) {
+      auto response = HandleRequest(request);
+      WriteFrame(connection.fd, response.type, response.payload);
+    }
+  } catch (const std::exception&) {
+    // Broken or malformed connection: drop it.
+  }
+  connection.done.store(true);
+}
+
+auto ReductionServer::HandleRequest(const Frame& request) -> Frame {
+  std::string key;
+  if (options_.cache_entries > 0) {
+    key.reserve(request.payload.size() + 1);
+    key.push_back(static_cast<char>(request.type));
+    key.append(request.payload);
+    std::string body;
+    if (CacheLookup(key, body)) {
+      return {FrameType::kOk, "cached: yes\n" + body};
+    }
+  }
+  auto future = pool_.Submit([this, &request](size_t worker) {
+    return Process(request, *workers_[worker]);
+  });
+  try {
+    auto body = future.get();
+    if (options_.cache_entries > 0) {
+      CacheStore(key, body);
+    }
+    return {FrameType::kOk, "cached: no\n" + body};
+  } catch (const std::exception& e) {
+    return {FrameType::kError, std::string("error: ") + e.what() + "\n"};
+  }
+}
+
+auto ReductionServer::Process(const Frame& request, WorkerState& state)
+    -> std::string {
+  switch (request.type) {
+    case FrameType::kThreeDMText:
+    case FrameType::kThreeDMBinary:
+      return ProcessThreeDM(request, state);
+    case FrameType::kPartitionText:
+      return ProcessPartition(request, state);
+    default:
+      throw std::runtime_error(
+          "Unknown request type " +
+          std::to_string(static_cast<unsigned>(request.type)));
+  }
+}
+
+auto ReductionServer::ProcessThreeDM(const Frame& request, WorkerState& state)
+    -> std::string {
+  auto start = Clock::now();
+  std::pmr::monotonic_buffer_resource arena(state.arena.data(),
+                                            state.arena.size());
+  MemoryInputStream input(request.payload);
+  auto three_dm = request.type == FrameType::kThreeDMBinary
+                      ? ThreeDMBinaryReader(&arena).ReadFromStream(input)
+                      : ThreeDMReader(&arena).ReadFromStream(input);
+  double parse_ms = MillisecondsSince(start);
+
+  auto phase_start = Clock::now();
+  auto reduced = state.reducer.ReduceCompact(three_dm);
+  double reduce_ms = MillisecondsSince(phase_start);
+
+  phase_start = Clock::now();
+  // Components are reduced and solved apart, each with its own q and p.
+  auto solution = state.component_solver.Solve(three_dm);
+  double solve_ms = MillisecondsSince(phase_start);
+
+  std::ostringstream body;
+  body << std::fixed << std::setprecision(3);
+  body << "timings_ms: parse=" << parse_ms << " reduce=" << reduce_ms
+       << " solve=" << solve_ms << " total=" << MillisecondsSince(start)
+       << "\n";
+  body << "solution: " << (solution ? "yes" : "no") << "\n";
+  if (solution) {
+    body << "matching:";
+    for (const auto& triple : *solution) {
+      body << " " << triple.ToString();
+    }
+    body << "\n";
+  }
+  body << "partition:\n";
+  ReducedPartitionWriter().WriteToStream(reduced, body);
+  if (request.payload.size() > state.arena.size()) {
+    // Parsed instances take a few times their text size; grow the arena so
+    // similar requests fit without touching the heap.
+    state.arena.resize(request.payload.size() * 4);
+  }
+  return body.str();
+}
+
+auto ReductionServer::ProcessPartition(const Frame& request,
+                                       WorkerState& state) -> std::string {
+  auto start = Clock::now();
+  std::pmr::monotonic_buffer_resource arena(state.arena.data(),
+                                            state.arena.size());
+  MemoryInputStream input(request.payload);
+  auto partition = PartitionReader(&arena).ReadFromStream(input);
+  double parse_ms = MillisecondsSince(start);
+
+  auto phase_start = Clock::now();
+  auto solution = state.partition_solver.Solve(partition);
+  double solve_ms = MillisecondsSince(phase_start);
+
+  std::ostringstream body;
+  body << std::fixed << std::setprecision(3);
+  body << "timings_ms: parse=" << parse_ms << " reduce=0.000"
+       << " solve=" << solve_ms << " total=" << MillisecondsSince(start)
+       << "\n";
+  body << "solution: " << (solution ? "yes" : "no") << "\n";
+  if (solution) {
+    body << "subset:";
+    for (const auto& id : *solution) {
+      body << " " << id;
+    }
+    body << "\n";
+  }
+  if (request.payload.size() > state.arena.size()) {
+    state.arena.resize(request.payload.size() * 4);
+  }
+  return body.str();
+}
+
+auto ReductionServer::CacheLookup(const std::string& key, std::string& body)
+    -> bool {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto found = cache_index_.find(key);
+  if (found == cache_index_.end()) {
+    return false;
+  }
+  cache_list_.splice(cache_list_.begin(), cache_list_, found->second);
+  body = found->second->second;
+  return true;
+}
+
+auto ReductionServer::CacheStore(const std::string& key,
+                                 const std::string& body) -> void {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (cache_index_.count(key) != 0) {
+    return;
+  }
+  cache_list_.emplace_front(key, body);
+  cache_index_[key] = cache_list_.begin();
+  if (cache_list_.size() > options_.cache_entries) {
+    cache_index_.erase(cache_list_.back().first);
+    cache_list_.pop_back();
+  }
+}
+
+}  // namespace partition
@@ -0,0 +1,107 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Daemon serving reduction requests over a Unix domain socket.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "server/reduction_server.h"
+
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+partition::ReductionServer* g_server = nullptr;
+
+void HandleSignal(int) {
+  if (g_server != nullptr) {
+    g_server->Stop();
+  }
+}
+
+}  // namespace
+
+void PrintHelp(const char* programName) {
+  std::cout << std::endl;
+  std::cout << "=== 3DM TO PARTITION SERVER ===" << std::endl << std::endl;
+  std::cout << "Usage:" << std::endl;
+  std::cout << "  " << programName << " [options]" << std::endl << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "  -s <path>   Socket path (default: /tmp/partition.sock)" << std::endl;
+  std::cout << "  -t <n>      Worker threads (default: one per core)" << std::endl;
+  std::cout << "  -c <n>      Cached responses, 0 disables the cache (default: 256)" << std::endl;
+  std::cout << "  -a <algo>   Solver for Partition requests: auto (default), backtracking, dp, multiset," << std::endl;
+  std::cout << "              sumset or greedy. auto picks one per instance with a cost model" << std::endl;
+  std::cout << "  --cost-model <file>  Cost model for auto, as written by bench -c" << std::endl;
+  std::cout << "  -h, --help  Show this help message" << std::endl << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  partition::ServerOptions options;
+  std::string cost_model_file;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((std::strcmp(argv[i], "-h") == 0) || (std::strcmp(argv[i], "--help") == 0)) {
+      PrintHelp(argv[0]);
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      options.socket_path = argv[++i];
+    } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      options.threads = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      options.cache_entries = std::stoul(argv[++i]);
+    } else if (std::strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+      std::string name = argv[++i];
+      if (name == "dp") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kDynamicProgramming;
+      } else if (name == "multiset") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kMultisetDynamicProgramming;
+      } else if (name == "sumset") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kSumsetConvolution;
+      } else if (name == "greedy") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kGreedyHeuristic;
+      } else if (name == "backtracking") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kBacktracking;
+      } else if (name == "auto") {
+        options.algorithm = partition::PartitionSolver::Algorithm::kAuto;
+      } else {
+        std::cerr << "Unknown algorithm: " << name << std::endl;
+        return 1;
+      }
+    } else if (std::strcmp(argv[i], "--cost-model") == 0 && i + 1 < argc) {
+      cost_model_file = argv[++i];
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << std::endl;
+      PrintHelp(argv[0]);
+      return 1;
+    }
+  }
+
+  try {
+    if (!cost_model_file.empty()) {
+      options.cost_model = std::make_shared<partition::SolverCostModel>(
+          partition::SolverCostModel::LoadFromFile(cost_model_file));
+    }
+    partition::ReductionServer server(options);
+    g_server = &server;
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+    std::cout << "Listening on " << options.socket_path << std::endl;
+    server.Run();
+    g_server = nullptr;
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,196 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionBitmapVerifier and
+ * ThreeDMBitmapVerifier.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/bitmap_verifier.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Runs check(i) for every i in [0, count) over the threads and
+ * collects the results.
+ */
+template <typename Check>
+auto RunBatch(size_t count, size_t threads, const Check& check)
+    -> std::vector<uint8_t> {
+  std::vector<uint8_t> results(count, 0);
+  ParallelFor(count, threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      results[i] = check(i);
+    }
+  });
+  return results;
+}
+
+/**
+ * @brief Sets bit index; returns false if it was already set.
+ */
+auto TestAndSet(std::vector<uint64_t>& bits, uint32_t index) -> bool {
+  uint64_t mask = uint64_t{1} << (index % 64);
+  uint64_t& word = bits[index / 64];
+  if (word & mask) {
+    return false;
+  }
+  word |= mask;
+  return true;
+}
+
+}  // namespace
+
+PartitionBitmapVerifier::PartitionBitmapVerifier(
+    const PartitionInstance& instance)
+    : size_(instance.size()),
+      total_(static_cast<uint64_t>(instance.total_sum())),
+      sizes_((instance.size() + 63) / 64 * 64, 0) {
+  const auto& elements = instance.elements();
+  index_.reserve(elements.size());
+  for (size_t i = 0; i < elements.size(); ++i) {
+    sizes_[i] = elements[i].size();
+    index_.emplace(elements[i].id(), static_cast<uint32_t>(i));
+  }
+}
+
+auto PartitionBitmapVerifier::ToBitmap(
+    const std::set<std::string>& subset) const
+    -> std::optional<SubsetBitmap> {
+  SubsetBitmap bitmap(words(), 0);
+  for (const auto& id : subset) {
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+      return std::nullopt;
+    }
+    bitmap[it->second / 64] |= uint64_t{1} << (it->second % 64);
+  }
+  return bitmap;
+}
+
+auto PartitionBitmapVerifier::SubsetSum(const SubsetBitmap& subset) const
+    -> std::optional<uint64_t> {
+  if (subset.size() != words()) {
+    return std::nullopt;
+  }
+  if (size_ % 64 != 0 && (subset.back() >> (size_ % 64)) != 0) {
+    return std::nullopt;
+  }
+  uint64_t sum = 0;
+  const uint64_t* sizes = sizes_.data();
+  for (size_t w = 0; w < subset.size(); ++w, sizes += 64) {
+    uint64_t bits = subset[w];
+    if (bits == 0) {
+      continue;
+    }
+    // Each size is ANDed with all ones or all zeros; no branch per bit,
+    // so the compiler can run the 64 lanes in vector registers.
+    uint64_t partial = 0;
+    for (size_t i = 0; i < 64; ++i) {
+      partial += sizes[i] & (uint64_t{0} - ((bits >> i) & 1));
+    }
+    sum += partial;
+  }
+  return sum;
+}
+
+auto PartitionBitmapVerifier::Verify(const SubsetBitmap& subset) const
+    -> bool {
+  auto sum = SubsetSum(subset);
+  return sum && *sum <= total_ && *sum == total_ - *sum;
+}
+
+auto PartitionBitmapVerifier::VerifyBatch(
+    const std::vector<SubsetBitmap>& candidates, size_t threads) const
+    -> std::vector<uint8_t> {
+  return RunBatch(candidates.size(), threads,
+                  [&](size_t i) { return Verify(candidates[i]); });
+}
+
+auto PartitionBitmapVerifier::VerifyBatch(
+    const std::vector<std::set<std::string>>& candidates, size_t threads) const
+    -> std::vector<uint8_t> {
+  return RunBatch(candidates.size(), threads, [&](size_t i) {
+    auto bitmap = ToBitmap(candidates[i]);
+    return bitmap && Verify(*bitmap);
+  });
+}
+
+ThreeDMBitmapVerifier::ThreeDMBitmapVerifier(const ThreeDMInstance& instance)
+    : q_(instance.q()), index_(instance, 1, 0) {}
+
+auto ThreeDMBitmapVerifier::ToIndices(const std::vector<Triple>& matching) const
+    -> std::optional<std::vector<uint32_t>> {
+  std::vector<uint32_t> indices;
+  indices.reserve(matching.size());
+  for (const auto& triple : matching) {
+    std::string_view names[3] = {triple.w(), triple.x(), triple.y()};
+    TripleConflictIndex::Coordinates coordinates;
+    for (size_t set = 0; set < 3; ++set) {
+      auto id = index_.ElementId(set, names[set]);
+      if (!id) {
+        return std::nullopt;
+      }
+      coordinates[set] = *id;
+    }
+    auto index = index_.FindTriple(coordinates);
+    if (!index) {
+      return std::nullopt;
+    }
+    indices.push_back(*index);
+  }
+  return indices;
+}
+
+auto ThreeDMBitmapVerifier::Verify(const std::vector<uint32_t>& matching) const
+    -> bool {
+  // q disjoint triples cover q elements of each set, which is all of them
+  // only when every set has exactly q elements.
+  if (matching.size() != q_ || index_.set_size(0) != q_ ||
+      index_.set_size(1) != q_ || index_.set_size(2) != q_) {
+    return false;
+  }
+  std::vector<uint64_t> covered(index_.element_count() / 64 + 1, 0);
+  for (uint32_t triple : matching) {
+    if (triple >= index_.triple_count()) {
+      return false;
+    }
+    for (uint32_t element : index_.coordinates(triple)) {
+      if (!TestAndSet(covered, element)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+auto ThreeDMBitmapVerifier::Verify(const std::vector<Triple>& matching) const
+    -> bool {
+  auto indices = ToIndices(matching);
+  return indices && Verify(*indices);
+}
+
+auto ThreeDMBitmapVerifier::VerifyBatch(
+    const std::vector<std::vector<uint32_t>>& candidates, size_t threads) const
+    -> std::vector<uint8_t> {
+  return RunBatch(candidates.size(), threads,
+                  [&](size_t i) { return Verify(candidates[i]); });
+}
+
+auto ThreeDMBitmapVerifier::VerifyBatch(
+    const std::vector<std::vector<Triple>>& candidates, size_t threads) const
+    -> std::vector<uint8_t> {
+  return RunBatch(candidates.size(), threads,
+                  [&](size_t i) { return Verify(candidates[i]); });
+}
+
+}  // namespace partition
@@ -0,0 +1,97 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ComponentSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/component_solver.h"
+#include "reduction/component_decomposer.h"
+#include "reduction/three_d_m_to_partition_reducer.h"
+#include "solvers/width_dispatch_solver.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+
+namespace partition {
+
+ComponentSolver::ComponentSolver(size_t threads) : threads_(threads) {}
+
+auto ComponentSolver::Solve(const ThreeDMInstance& instance)
+    -> std::optional<std::vector<Triple>> {
+  auto components = ComponentDecomposer(threads_).Decompose(instance);
+  last_components_ = components.size();
+  for (const auto& component : components) {
+    if (!component.instance.IsValid() ||
+        component.triples.size() < component.instance.q()) {
+      return std::nullopt;
+    }
+  }
+
+  // Largest first, so a big component does not start last and run alone.
+  std::vector<size_t> order(components.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return components[a].triples.size() > components[b].triples.size();
+  });
+  std::vector<std::vector<Triple>> matchings(components.size());
+  std::atomic<size_t> next{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  size_t workers = std::min(ResolveThreads(threads_), components.size());
+  ParallelFor(workers, workers, [&](size_t, size_t) {
+    // The reducer keeps per-instance state, so each worker has its own.
+    ThreeDMToPartitionReducer reducer;
+    WidthDispatchSolver solver(PartitionSolver::Algorithm::kAuto);
+    while (!failed.load(std::memory_order_relaxed)) {
+      size_t position = next.fetch_add(1, std::memory_order_relaxed);
+      if (position >= order.size()) {
+        return;
+      }
+      const auto& component = components[order[position]].instance;
+      try {
+        auto reduced = reducer.ReduceCompact(component);
+        auto solution = solver.Solve(reduced);
+        if (!solution) {
+          failed.store(true, std::memory_order_relaxed);
+          return;
+        }
+        matchings[order[position]] =
+            reducer.MapSolutionBack(*solution, component);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        error = std::current_exception();
+        failed.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  });
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (failed.load()) {
+    return std::nullopt;
+  }
+  std::vector<Triple> matching;
+  matching.reserve(instance.q());
+  for (auto& part : matchings) {
+    std::move(part.begin(), part.end(), std::back_inserter(matching));
+  }
+  return matching;
+}
+
+auto ComponentSolver::GetAlgorithmName() const -> std::string {
+  return "Component Decomposition";
+}
+
+}  // namespace partition
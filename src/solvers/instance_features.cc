@@ -0,0 +1,140 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the instance feature extractors.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/instance_features.h"
+#include "core/triple_conflict_index.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+constexpr uint64_t kSaturated = std::numeric_limits<uint64_t>::max();
+
+auto Saturate(const WideUnsigned& value) -> uint64_t {
+  return value.FitsInUint64() ? value.ToUint64() : kSaturated;
+}
+
+/**
+ * @brief 2^exponent * factor, saturated.
+ */
+auto ScaledPow2(double factor, size_t exponent) -> uint64_t {
+  double value = std::ldexp(factor, static_cast<int>(exponent));
+  return value >= 18446744073709551615.0 ? kSaturated
+                                         : static_cast<uint64_t>(value);
+}
+
+}  // namespace
+
+auto ExtractFeatures(std::span<const uint64_t> sizes) -> PartitionFeatures {
+  PartitionFeatures features;
+  features.n = sizes.size();
+  std::vector<uint64_t> sorted(sizes.begin(), sizes.end());
+  std::sort(sorted.begin(), sorted.end());
+  features.distinct_sizes = static_cast<size_t>(
+      std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+  for (uint64_t size : sizes) {
+    features.max_size = std::max(features.max_size, size);
+    features.total_sum = features.total_sum > kSaturated - size
+                             ? kSaturated
+                             : features.total_sum + size;
+  }
+  features.bit_width = static_cast<size_t>(std::bit_width(features.max_size));
+  features.reduced =
+      sizes.size() >= 3 &&
+      std::all_of(sizes.begin(), sizes.end() - 2,
+                  [](uint64_t size) { return std::popcount(size) == 3; });
+  return features;
+}
+
+auto ExtractFeatures(const PartitionInstance& instance) -> PartitionFeatures {
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.push_back(element.size());
+  }
+  return ExtractFeatures(sizes);
+}
+
+auto ExtractFeatures(const ReducedPartitionInstance& instance)
+    -> PartitionFeatures {
+  PartitionFeatures features;
+  size_t k = instance.triple_count();
+  features.n = instance.size();
+  std::vector<ReducedPartitionInstance::Positions> triples;
+  triples.reserve(k);
+  for (size_t i = 0; i < k; ++i) {
+    auto positions = instance.positions(i);
+    std::sort(positions.begin(), positions.end());
+    triples.push_back(positions);
+  }
+  std::sort(triples.begin(), triples.end());
+  features.distinct_sizes = static_cast<size_t>(
+      std::unique(triples.begin(), triples.end()) - triples.begin());
+  // b1 = 2T - B and b2 = T + B; b1 is the largest unless B > T / 2.
+  auto b1 = instance.ElementSize(k);
+  auto b2 = instance.ElementSize(k + 1);
+  const auto& largest = b1 < b2 ? b2 : b1;
+  features.distinct_sizes += b1 == b2 ? 1 : 2;
+  features.max_size = Saturate(largest);
+  features.total_sum = Saturate(instance.TotalSum());
+  features.bit_width = largest.BitWidth();
+  features.reduced = true;
+  return features;
+}
+
+auto ExtractFeatures(const ThreeDMInstance& instance) -> ThreeDMFeatures {
+  ThreeDMFeatures features;
+  features.q = instance.q();
+  features.k = instance.triples().size();
+  TripleConflictIndex index(instance, 1, 0);
+  size_t elements = index.element_count();
+  if (elements == 0) {
+    return features;
+  }
+  features.min_degree = std::numeric_limits<size_t>::max();
+  for (uint32_t element = 0; element < elements; ++element) {
+    size_t degree = index.TriplesWith(element).size();
+    features.min_degree = std::min(features.min_degree, degree);
+    features.max_degree = std::max(features.max_degree, degree);
+  }
+  features.mean_degree = 3.0 * static_cast<double>(features.k) /
+                         static_cast<double>(elements);
+  return features;
+}
+
+auto ReductionFeatures(const ThreeDMFeatures& features) -> PartitionFeatures {
+  PartitionFeatures reduced;
+  reduced.n = features.k + 2;
+  reduced.distinct_sizes = features.k + 2;
+  reduced.reduced = true;
+  if (features.q == 0) {
+    return reduced;
+  }
+  // Fields of p bits, one per element; field i of T holds the degree of
+  // its element, so T is about mean_degree * B with B just over
+  // 2^(p (3q - 1)), and the total is 4T.
+  auto p = static_cast<size_t>(std::bit_width(features.k));
+  size_t top_field = p * (3 * features.q - 1);
+  double mean = std::max(features.mean_degree, 1.0);
+  reduced.total_sum = ScaledPow2(4 * mean, top_field);
+  reduced.max_size = ScaledPow2(2 * mean, top_field);
+  reduced.bit_width = top_field + static_cast<size_t>(std::ceil(
+                                      std::log2(2 * mean + 1)));
+  return reduced;
+}
+
+}  // namespace partition
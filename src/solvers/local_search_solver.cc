@@ -0,0 +1,484 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for LocalSearchSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/local_search_solver.h"
+#include "util/metrics.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <tuple>
+
+namespace partition {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+/// Random 2-for-1 and 1-for-2 candidates per descent step.
+constexpr size_t kPairSamples = 32;
+/// Non-tabu elements tried on each side of a binary search hit.
+constexpr size_t kScan = 2;
+/// Kicks without a new best before a worker restarts, alternately from
+/// its best split and from a randomized Karmarkar-Karp one.
+constexpr size_t kRestartKicks = 32;
+/// One in this many randomized Karmarkar-Karp merges skips a value.
+constexpr uint64_t kRandomMerge = 8;
+
+/**
+ * @brief Karmarkar-Karp differencing: replaces the two largest values by
+ * their difference, which commits them to opposite sides, until one
+ * value is left. The commitments form a tree, two-coloured into sides.
+ * @param rng If given, one merge in kRandomMerge pairs the largest value
+ * with the third largest instead, for a different but similar split.
+ */
+auto KarmarkarKarp(const std::vector<uint64_t>& sizes,
+                   std::mt19937_64* rng = nullptr) -> std::vector<uint8_t> {
+  size_t n = sizes.size();
+  std::priority_queue<std::pair<uint64_t, uint32_t>> heap;
+  for (size_t i = 0; i < n; ++i) {
+    heap.emplace(sizes[i], static_cast<uint32_t>(i));
+  }
+  // Adjacency lists of the tree, as linked edges.
+  std::vector<uint32_t> head(n, kNone);
+  std::vector<uint32_t> next;
+  std::vector<uint32_t> to;
+  next.reserve(2 * n);
+  to.reserve(2 * n);
+  auto link = [&](uint32_t a, uint32_t b) {
+    to.push_back(b);
+    next.push_back(head[a]);
+    head[a] = static_cast<uint32_t>(to.size() - 1);
+  };
+  while (heap.size() > 1) {
+    auto [a, a_id] = heap.top();
+    heap.pop();
+    auto [b, b_id] = heap.top();
+    heap.pop();
+    if (rng && !heap.empty() && (*rng)() % kRandomMerge == 0) {
+      auto third = heap.top();
+      heap.pop();
+      heap.emplace(b, b_id);
+      std::tie(b, b_id) = third;
+    }
+    link(a_id, b_id);
+    link(b_id, a_id);
+    heap.emplace(a - b, a_id);
+  }
+  std::vector<uint8_t> sides(n, 2);
+  std::vector<uint32_t> queue;
+  queue.reserve(n);
+  if (n > 0) {
+    sides[0] = 0;
+    queue.push_back(0);
+  }
+  for (size_t i = 0; i < queue.size(); ++i) {
+    uint32_t u = queue[i];
+    for (uint32_t e = head[u]; e != kNone; e = next[e]) {
+      if (sides[to[e]] == 2) {
+        sides[to[e]] = static_cast<uint8_t>(1 - sides[u]);
+        queue.push_back(to[e]);
+      }
+    }
+  }
+  return sides;
+}
+
+auto Difference(const std::vector<uint64_t>& sizes,
+                const std::vector<uint8_t>& sides) -> uint64_t {
+  uint64_t sums[2] = {0, 0};
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    sums[sides[i]] += sizes[i];
+  }
+  return sums[0] > sums[1] ? sums[0] - sums[1] : sums[1] - sums[0];
+}
+
+/**
+ * @brief Best split of the ensemble, shared under a mutex; difference is
+ * also readable without it.
+ */
+struct SharedBest {
+  std::mutex mutex;
+  std::atomic<uint64_t> difference;
+  std::vector<uint8_t> sides;
+  std::atomic<bool> done{false};
+};
+
+/**
+ * @brief One local-search walker: the current split with each side sorted
+ * by size, plus its tabu state.
+ */
+class Walker {
+ public:
+  Walker(const std::vector<uint64_t>& sizes, uint64_t seed, size_t tenure)
+      : sizes_(sizes),
+        sides_(sizes.size(), 0),
+        tabu_until_(sizes.size(), 0),
+        rng_(seed),
+        tenure_(tenure) {
+    lists_[0].reserve(sizes.size());
+    lists_[1].reserve(sizes.size());
+  }
+
+  /**
+   * @brief Continues from the given split.
+   */
+  auto Load(const std::vector<uint8_t>& sides) -> void {
+    sides_ = sides;
+    lists_[0].clear();
+    lists_[1].clear();
+    sums_[0] = sums_[1] = 0;
+    for (uint32_t e = 0; e < sides_.size(); ++e) {
+      lists_[sides_[e]].push_back(e);
+      sums_[sides_[e]] += sizes_[e];
+    }
+    BySize less{&sizes_};
+    std::sort(lists_[0].begin(), lists_[0].end(), less);
+    std::sort(lists_[1].begin(), lists_[1].end(), less);
+  }
+
+  /**
+   * @brief Applies the best improving move until there is none or stop
+   * says so.
+   */
+  template <typename Stop>
+  auto Descend(const Stop& stop) -> void {
+    while (!stop() && Step()) {
+    }
+  }
+
+  /**
+   * @brief A few random swaps, whose elements become tabu.
+   */
+  auto Kick() -> void {
+    size_t swaps = 1 + rng_() % 3;
+    for (size_t s = 0; s < swaps; ++s) {
+      for (int side = 0; side < 2; ++side) {
+        if (lists_[side].empty()) {
+          continue;
+        }
+        uint32_t e = lists_[side][rng_() % lists_[side].size()];
+        Move(e);
+        tabu_until_[e] = moves_ + tenure_;
+      }
+    }
+  }
+
+  auto difference() const -> uint64_t {
+    return sums_[0] > sums_[1] ? sums_[0] - sums_[1] : sums_[1] - sums_[0];
+  }
+
+  auto sides() const -> const std::vector<uint8_t>& { return sides_; }
+
+  /**
+   * @brief Continues from a fresh randomized Karmarkar-Karp split.
+   */
+  auto Reseed() -> void { Load(KarmarkarKarp(sizes_, &rng_)); }
+
+ private:
+  /**
+   * @brief Moves out of the heavier side and in from the lighter one.
+   */
+  struct Candidate {
+    uint64_t difference;
+    uint32_t out[2];
+    uint32_t in[2];
+  };
+
+  /**
+   * @brief Order of the side lists: by size, then by index.
+   */
+  struct BySize {
+    const std::vector<uint64_t>* sizes;
+
+    auto operator()(uint32_t a, uint32_t b) const -> bool {
+      uint64_t size_a = (*sizes)[a];
+      uint64_t size_b = (*sizes)[b];
+      return size_a < size_b || (size_a == size_b && a < b);
+    }
+  };
+
+  auto Free(uint32_t e) const -> bool { return tabu_until_[e] <= moves_; }
+
+  auto Move(uint32_t e) -> void {
+    int from = sides_[e];
+    BySize less{&sizes_};
+    auto& source = lists_[from];
+    source.erase(std::lower_bound(source.begin(), source.end(), e, less));
+    auto& target = lists_[1 - from];
+    target.insert(std::lower_bound(target.begin(), target.end(), e, less), e);
+    sums_[from] -= sizes_[e];
+    sums_[1 - from] += sizes_[e];
+    sides_[e] = static_cast<uint8_t>(1 - from);
+    ++moves_;
+  }
+
+  /**
+   * @brief Calls visit on up to kScan free elements of list on each side
+   * of the first one not smaller than value.
+   */
+  template <typename Visit>
+  auto ScanNear(const std::vector<uint32_t>& list, uint64_t value,
+                const Visit& visit) const -> void {
+    auto position = static_cast<size_t>(
+        std::lower_bound(list.begin(), list.end(), value,
+                         [this](uint32_t e, uint64_t v) {
+                           return sizes_[e] < v;
+                         }) -
+        list.begin());
+    size_t limit = kScan + tenure_;
+    for (size_t i = position, found = 0, seen = 0;
+         i-- > 0 && found < kScan && seen < limit; ++seen) {
+      if (Free(list[i])) {
+        visit(list[i]);
+        ++found;
+      }
+    }
+    for (size_t i = position, found = 0, seen = 0;
+         i < list.size() && found < kScan && seen < limit; ++i, ++seen) {
+      if (Free(list[i])) {
+        visit(list[i]);
+        ++found;
+      }
+    }
+  }
+
+  /**
+   * @brief Moving weight x from the heavier side to the lighter one turns
+   * a difference d into |d - 2x|; only 0 < x < d improves it.
+   */
+  static auto After(uint64_t d, uint64_t x) -> uint64_t {
+    if (x == 0 || x >= d) {
+      return d;
+    }
+    return x <= d - x ? (d - x) - x : x - (d - x);
+  }
+
+  auto Step() -> bool {
+    uint64_t d = difference();
+    if (d == 0) {
+      return false;
+    }
+    int heavy = sums_[0] >= sums_[1] ? 0 : 1;
+    const auto& heavier = lists_[heavy];
+    const auto& lighter = lists_[1 - heavy];
+    uint64_t half = d / 2;
+    Candidate best{d, {kNone, kNone}, {kNone, kNone}};
+    auto consider = [&](uint64_t x, uint32_t out0, uint32_t out1,
+                        uint32_t in0, uint32_t in1) {
+      uint64_t after = After(d, x);
+      if (after < best.difference) {
+        best = {after, {out0, out1}, {in0, in1}};
+      }
+    };
+    auto below = [half](uint64_t weight) {
+      return weight > half ? weight - half : 0;
+    };
+
+    // One element across.
+    ScanNear(heavier, half, [&](uint32_t i) {
+      consider(sizes_[i], i, kNone, kNone, kNone);
+    });
+    // Swaps: for each element, the partner closest to size - d / 2.
+    for (uint32_t i : heavier) {
+      uint64_t size = sizes_[i];
+      if (size == 0 || !Free(i)) {
+        continue;
+      }
+      ScanNear(lighter, below(size), [&](uint32_t j) {
+        if (sizes_[j] < size) {
+          consider(size - sizes_[j], i, kNone, j, kNone);
+        }
+      });
+    }
+    if (heavier.size() >= 2 && !lighter.empty()) {
+      for (size_t sample = 0; sample < kPairSamples; ++sample) {
+        // Two for one.
+        uint32_t i = heavier[rng_() % heavier.size()];
+        uint32_t k = heavier[rng_() % heavier.size()];
+        if (i != k && Free(i) && Free(k)) {
+          uint64_t weight = sizes_[i] + sizes_[k];
+          ScanNear(lighter, below(weight), [&](uint32_t j) {
+            if (sizes_[j] < weight) {
+              consider(weight - sizes_[j], i, k, j, kNone);
+            }
+          });
+        }
+        // One for two.
+        uint32_t j = lighter[rng_() % lighter.size()];
+        if (Free(i) && Free(j) && sizes_[i] > sizes_[j]) {
+          uint64_t weight = sizes_[i] - sizes_[j];
+          ScanNear(lighter, below(weight), [&](uint32_t l) {
+            if (l != j && sizes_[l] < weight) {
+              consider(weight - sizes_[l], i, kNone, j, l);
+            }
+          });
+        }
+      }
+    }
+
+    if (best.difference >= d) {
+      return false;
+    }
+    for (uint32_t e : {best.out[0], best.out[1], best.in[0], best.in[1]}) {
+      if (e != kNone) {
+        Move(e);
+      }
+    }
+    return true;
+  }
+
+  const std::vector<uint64_t>& sizes_;
+  std::vector<uint8_t> sides_;
+  std::vector<uint32_t> lists_[2];
+  uint64_t sums_[2] = {0, 0};
+  std::vector<uint64_t> tabu_until_;
+  uint64_t moves_ = 0;
+  std::mt19937_64 rng_;
+  size_t tenure_;
+};
+
+}  // namespace
+
+LocalSearchSolver::LocalSearchSolver(LocalSearchOptions options)
+    : options_(options) {}
+
+auto LocalSearchSolver::SolveMinimumDifference(
+    const PartitionInstance& instance) -> PartitionSplit {
+  PARTITION_METRICS_PHASE(kSolve);
+  auto start = Clock::now();
+  auto deadline =
+      start + std::chrono::duration_cast<Clock::duration>(
+                  std::chrono::duration<double, std::milli>(
+                      options_.time_budget_ms));
+  auto elapsed_ms = [&] {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+  };
+  const auto& elements = instance.elements();
+  std::vector<uint64_t> sizes;
+  sizes.reserve(elements.size());
+  for (const auto& element : elements) {
+    sizes.push_back(element.size());
+  }
+  uint64_t parity = static_cast<uint64_t>(instance.total_sum()) % 2;
+
+  SharedBest shared;
+  shared.sides = KarmarkarKarp(sizes);
+  shared.difference = Difference(sizes, shared.sides);
+  trace_.clear();
+  auto record = [&](uint64_t difference, size_t worker) {
+    trace_.push_back({elapsed_ms(), difference, worker});
+    if (progress_) {
+      progress_(trace_.back());
+    }
+  };
+  record(shared.difference, 0);
+  shared.done = shared.difference <= parity || sizes.size() < 2;
+
+  std::exception_ptr error;
+  size_t workers = ResolveThreads(options_.threads);
+  ParallelFor(workers, workers, [&](size_t begin, size_t end) {
+    for (size_t worker = begin; worker < end; ++worker) {
+      auto stop = [&] {
+        return shared.done.load(std::memory_order_relaxed) ||
+               Clock::now() >= deadline;
+      };
+      try {
+        if (stop()) {
+          return;
+        }
+        Walker walker(sizes, options_.seed + worker, options_.tabu_tenure);
+        std::vector<uint8_t> best;
+        {
+          std::lock_guard<std::mutex> lock(shared.mutex);
+          best = shared.sides;
+        }
+        walker.Load(best);
+        uint64_t best_difference = walker.difference();
+        size_t since_best = 0;
+        size_t restarts = 0;
+        bool first = true;
+        while (!stop()) {
+          for (size_t round = 0; round < options_.share_interval && !stop();
+               ++round) {
+            if (!first) {
+              walker.Kick();
+            }
+            first = false;
+            walker.Descend(stop);
+            if (walker.difference() < best_difference) {
+              best_difference = walker.difference();
+              best = walker.sides();
+              since_best = 0;
+              if (best_difference <= parity) {
+                break;
+              }
+            } else if (++since_best >= kRestartKicks) {
+              if (++restarts % 2 == 0) {
+                walker.Load(best);
+              } else {
+                walker.Reseed();
+              }
+              since_best = 0;
+            }
+          }
+          // Publish a better split, or adopt the ensemble's.
+          if (best_difference < shared.difference.load()) {
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            if (best_difference < shared.difference.load()) {
+              shared.sides = best;
+              shared.difference = best_difference;
+              record(best_difference, worker);
+              if (best_difference <= parity) {
+                shared.done = true;
+              }
+            }
+          } else if (shared.difference.load() < best_difference) {
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            best = shared.sides;
+            best_difference = shared.difference.load();
+            walker.Load(best);
+            since_best = 0;
+          }
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        error = std::current_exception();
+        shared.done = true;
+      }
+    }
+  });
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  std::vector<size_t> side;
+  for (size_t i = 0; i < shared.sides.size(); ++i) {
+    if (shared.sides[i] == 0) {
+      side.push_back(i);
+    }
+  }
+  return MakePartitionSplit(instance, side, false);
+}
+
+auto LocalSearchSolver::GetAlgorithmName() const -> std::string {
+  return "Ensemble Local Search";
+}
+
+}  // namespace partition
@@ -0,0 +1,285 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for MatchingCounter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/matching_counter.h"
+#include "core/triple_conflict_index.h"
+#include "reduction/component_decomposer.h"
+#include "util/metrics.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Exact cover matrix as doubly linked lists: node 0 is the root,
+ * nodes 1..columns the column headers and then three nodes per triple.
+ * Covering a column unlinks it and every row through it; uncovering in
+ * reverse order relinks them.
+ */
+class DancingLinks {
+ public:
+  explicit DancingLinks(const TripleConflictIndex& index)
+      : columns_(index.element_count()),
+        covered_((columns_ + 63) / 64, 0) {
+    size_t nodes = columns_ + 1 + 3 * index.triple_count();
+    left_.resize(nodes);
+    right_.resize(nodes);
+    up_.resize(nodes);
+    down_.resize(nodes);
+    column_.resize(nodes);
+    row_.resize(nodes, 0);
+    size_.assign(columns_ + 1, 0);
+    for (uint32_t c = 0; c <= columns_; ++c) {
+      left_[c] = c == 0 ? static_cast<uint32_t>(columns_) : c - 1;
+      right_[c] = c == columns_ ? 0 : c + 1;
+      up_[c] = down_[c] = column_[c] = c;
+    }
+    auto node = static_cast<uint32_t>(columns_ + 1);
+    for (size_t t = 0; t < index.triple_count(); ++t) {
+      uint32_t first = node;
+      for (uint32_t element : index.coordinates(t)) {
+        uint32_t c = element + 1;
+        column_[node] = c;
+        row_[node] = static_cast<uint32_t>(t);
+        up_[node] = up_[c];
+        down_[node] = c;
+        down_[up_[c]] = node;
+        up_[c] = node;
+        ++size_[c];
+        left_[node] = node == first ? first + 2 : node - 1;
+        right_[node] = node == first + 2 ? first : node + 1;
+        ++node;
+      }
+    }
+  }
+
+  auto Done() const -> bool { return right_[0] == 0; }
+
+  /**
+   * @brief Uncovered column with the fewest rows.
+   */
+  auto Choose() const -> uint32_t {
+    uint32_t best = right_[0];
+    for (uint32_t c = right_[best]; c != 0; c = right_[c]) {
+      if (size_[c] < size_[best]) {
+        best = c;
+      }
+    }
+    return best;
+  }
+
+  auto Cover(uint32_t c) -> void {
+    right_[left_[c]] = right_[c];
+    left_[right_[c]] = left_[c];
+    for (uint32_t i = down_[c]; i != c; i = down_[i]) {
+      for (uint32_t j = right_[i]; j != i; j = right_[j]) {
+        down_[up_[j]] = down_[j];
+        up_[down_[j]] = up_[j];
+        --size_[column_[j]];
+      }
+    }
+    covered_[(c - 1) / 64] |= uint64_t{1} << ((c - 1) % 64);
+  }
+
+  auto Uncover(uint32_t c) -> void {
+    covered_[(c - 1) / 64] &= ~(uint64_t{1} << ((c - 1) % 64));
+    for (uint32_t i = up_[c]; i != c; i = up_[i]) {
+      for (uint32_t j = left_[i]; j != i; j = left_[j]) {
+        ++size_[column_[j]];
+        down_[up_[j]] = j;
+        up_[down_[j]] = j;
+      }
+    }
+    right_[left_[c]] = c;
+    left_[right_[c]] = c;
+  }
+
+  /**
+   * @brief Covers the other columns of the row through node.
+   */
+  auto CoverRow(uint32_t node) -> void {
+    for (uint32_t j = right_[node]; j != node; j = right_[j]) {
+      Cover(column_[j]);
+    }
+  }
+
+  auto UncoverRow(uint32_t node) -> void {
+    for (uint32_t j = left_[node]; j != node; j = left_[j]) {
+      Uncover(column_[j]);
+    }
+  }
+
+  auto Down(uint32_t node) const -> uint32_t { return down_[node]; }
+  auto ColumnOf(uint32_t node) const -> uint32_t { return column_[node]; }
+  auto RowOf(uint32_t node) const -> uint32_t { return row_[node]; }
+
+  /**
+   * @brief The set of covered columns, as a hashable key.
+   */
+  auto Key() const -> std::string {
+    return std::string(reinterpret_cast<const char*>(covered_.data()),
+                       covered_.size() * sizeof(uint64_t));
+  }
+
+ private:
+  size_t columns_;
+  std::vector<uint32_t> left_;
+  std::vector<uint32_t> right_;
+  std::vector<uint32_t> up_;
+  std::vector<uint32_t> down_;
+  std::vector<uint32_t> column_;
+  std::vector<uint32_t> row_;
+  std::vector<uint32_t> size_;
+  std::vector<uint64_t> covered_;
+};
+
+/**
+ * @brief Memoized count of the exact covers of the uncovered columns.
+ */
+class CoverCounter {
+ public:
+  CoverCounter(DancingLinks& links, size_t max_memo_entries)
+      : links_(links), max_memo_entries_(max_memo_entries) {}
+
+  auto Count() -> WideUnsigned {
+    ++nodes_explored_;
+    if (links_.Done()) {
+      return WideUnsigned(1);
+    }
+    std::string key;
+    if (max_memo_entries_ > 0) {
+      key = links_.Key();
+      auto found = memo_.find(key);
+      if (found != memo_.end()) {
+        return found->second;
+      }
+    }
+    WideUnsigned total;
+    uint32_t c = links_.Choose();
+    links_.Cover(c);
+    for (uint32_t node = links_.Down(c); node != c; node = links_.Down(node)) {
+      links_.CoverRow(node);
+      total += Count();
+      links_.UncoverRow(node);
+    }
+    links_.Uncover(c);
+    if (max_memo_entries_ > 0 && memo_.size() < max_memo_entries_) {
+      memo_.emplace(std::move(key), total);
+    }
+    return total;
+  }
+
+  auto nodes_explored() const -> uint64_t { return nodes_explored_; }
+
+ private:
+  DancingLinks& links_;
+  size_t max_memo_entries_;
+  std::unordered_map<std::string, WideUnsigned> memo_;
+  uint64_t nodes_explored_ = 0;
+};
+
+auto Multiply(const WideUnsigned& a, const WideUnsigned& b) -> WideUnsigned {
+  WideUnsigned product;
+  for (size_t limb = 0; limb < b.limbs().size(); ++limb) {
+    WideUnsigned partial = a;
+    partial *= b.limbs()[limb];
+    partial <<= 64 * limb;
+    product += partial;
+  }
+  return product;
+}
+
+}  // namespace
+
+MatchingCounter::MatchingCounter(size_t max_memo_entries)
+    : max_memo_entries_(max_memo_entries) {}
+
+auto MatchingCounter::Count(const ThreeDMInstance& instance) const
+    -> WideUnsigned {
+  PARTITION_METRICS_PHASE(kSolve);
+  if (!instance.IsValid()) {
+    return WideUnsigned();
+  }
+  WideUnsigned product(1);
+  uint64_t nodes_explored = 0;
+  for (const auto& component : ComponentDecomposer().Decompose(instance)) {
+    if (!component.instance.IsValid() ||
+        component.triples.size() < component.instance.q()) {
+      return WideUnsigned();
+    }
+    TripleConflictIndex index(component.instance, 1, 0);
+    DancingLinks links(index);
+    CoverCounter counter(links, max_memo_entries_);
+    auto count = counter.Count();
+    nodes_explored += counter.nodes_explored();
+    if (count.IsZero()) {
+      PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored);
+      return count;
+    }
+    product = Multiply(product, count);
+  }
+  PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored);
+  return product;
+}
+
+auto MatchingCounter::Enumerate(const ThreeDMInstance& instance) const
+    -> Generator<std::vector<Triple>> {
+  if (!instance.IsValid()) {
+    co_return;
+  }
+  TripleConflictIndex index(instance, 1, 0);
+  DancingLinks links(index);
+  // path holds the chosen row node at each depth, or the column header
+  // while no row of that column has been tried yet.
+  std::vector<uint32_t> path;
+  path.reserve(instance.q());
+  bool descend = true;
+  while (true) {
+    if (descend) {
+      descend = false;
+      if (links.Done()) {
+        std::vector<Triple> matching;
+        matching.reserve(path.size());
+        for (uint32_t node : path) {
+          matching.push_back(instance.triples()[links.RowOf(node)]);
+        }
+        co_yield matching;
+      } else {
+        uint32_t c = links.Choose();
+        links.Cover(c);
+        path.push_back(c);
+      }
+    }
+    if (path.empty()) {
+      break;
+    }
+    uint32_t node = path.back();
+    uint32_t c = links.ColumnOf(node);
+    if (node != c) {
+      links.UncoverRow(node);
+    }
+    node = links.Down(node);
+    if (node == c) {
+      links.Uncover(c);
+      path.pop_back();
+      continue;
+    }
+    links.CoverRow(node);
+    path.back() = node;
+    descend = true;
+  }
+}
+
+}  // namespace partition
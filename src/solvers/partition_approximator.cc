@@ -0,0 +1,137 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionApproximator.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/partition_approximator.h"
+#include "util/metrics.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+constexpr uint32_t kNoParent = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief A kept subset sum: the element added last and the sum it was
+ * added to, so the subset can be walked back.
+ */
+struct SumNode {
+  uint64_t sum;
+  uint32_t parent;
+  uint32_t element;
+};
+
+}  // namespace
+
+PartitionApproximator::PartitionApproximator(double epsilon)
+    : epsilon_(epsilon) {
+  if (!(epsilon > 0.0 && epsilon < 1.0)) {
+    throw std::invalid_argument("Epsilon must be in (0, 1), got " +
+                                std::to_string(epsilon));
+  }
+}
+
+auto PartitionApproximator::SolveMinimumDifference(
+    const PartitionInstance& instance) const -> PartitionSplit {
+  PARTITION_METRICS_PHASE(kSolve);
+  const auto& elements = instance.elements();
+  uint64_t target = static_cast<uint64_t>(instance.total_sum()) / 2;
+  auto small_limit = static_cast<uint64_t>(
+      epsilon_ * static_cast<long double>(target) / 2);
+  std::vector<uint32_t> large;
+  std::vector<uint32_t> small;
+  for (size_t i = 0; i < elements.size(); ++i) {
+    uint64_t size = elements[i].size();
+    if (size > target) {
+      continue;
+    }
+    (size <= small_limit ? small : large).push_back(static_cast<uint32_t>(i));
+  }
+
+  // Trimmed list of sums of large sizes, kept sorted.
+  std::vector<SumNode> nodes = {{0, kNoParent, 0}};
+  std::vector<uint32_t> sums = {0};
+  std::vector<uint32_t> next;
+  auto delta = static_cast<uint64_t>(
+      epsilon_ * static_cast<long double>(target) /
+      (2 * static_cast<long double>(std::max<size_t>(large.size(), 1))));
+  for (uint32_t element : large) {
+    uint64_t size = elements[element].size();
+    next.clear();
+    uint64_t last = 0;
+    // Merges sums and sums + size; a sum within delta of the last kept one
+    // is in the same interval and is dropped.
+    size_t a = 0;
+    size_t b = 0;
+    while (true) {
+      uint64_t shifted = std::numeric_limits<uint64_t>::max();
+      if (b < sums.size() && nodes[sums[b]].sum + size <= target) {
+        shifted = nodes[sums[b]].sum + size;
+      }
+      if (a < sums.size() && nodes[sums[a]].sum <= shifted) {
+        uint64_t sum = nodes[sums[a]].sum;
+        if (next.empty() || sum > last + delta) {
+          next.push_back(sums[a]);
+          last = sum;
+        }
+        ++a;
+      } else if (shifted != std::numeric_limits<uint64_t>::max()) {
+        if (next.empty() || shifted > last + delta) {
+          if (nodes.size() >= kNoParent) {
+            throw std::length_error("Epsilon " + std::to_string(epsilon_) +
+                                    " keeps too many subset sums");
+          }
+          nodes.push_back({shifted, sums[b], element});
+          next.push_back(static_cast<uint32_t>(nodes.size() - 1));
+          last = shifted;
+        }
+        ++b;
+      } else {
+        break;
+      }
+    }
+    sums.swap(next);
+  }
+
+  std::vector<size_t> chosen;
+  uint64_t subset_sum = nodes[sums.back()].sum;
+  for (uint32_t node = sums.back(); nodes[node].parent != kNoParent;
+       node = nodes[node].parent) {
+    chosen.push_back(nodes[node].element);
+  }
+  // First fit, largest first: a small size that does not fit means the
+  // sum is already within epsilon * T / 2 of T.
+  std::sort(small.begin(), small.end(), [&](uint32_t a, uint32_t b) {
+    return elements[a].size() > elements[b].size();
+  });
+  for (uint32_t element : small) {
+    if (subset_sum + elements[element].size() <= target) {
+      subset_sum += elements[element].size();
+      chosen.push_back(element);
+    }
+  }
+  return MakePartitionSplit(instance, chosen, false);
+}
+
+auto PartitionApproximator::GetAlgorithmName() const -> std::string {
+  char name[64];
+  std::snprintf(name, sizeof(name), "Approximation Scheme (epsilon = %g)",
+                epsilon_);
+  return name;
+}
+
+}  // namespace partition
@@ -0,0 +1,237 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionCounter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/partition_counter.h"
+#include "solvers/partition_filter.h"
+#include "util/metrics.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+/**
+ * @brief Bytes of rows * words 64-bit words, saturated.
+ */
+auto TableBytes(uint64_t rows, uint64_t words) -> uint64_t {
+  constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  if (words != 0 && rows > kMax / sizeof(uint64_t) / words) {
+    return kMax;
+  }
+  return rows * words * sizeof(uint64_t);
+}
+
+/**
+ * @throws std::length_error if bytes exceeds max_bytes.
+ */
+auto CheckTable(uint64_t bytes, size_t max_bytes, const char* what) -> void {
+  if (bytes > max_bytes) {
+    throw std::length_error(std::string(what) + " needs " +
+                            std::to_string(bytes) + " bytes, over the " +
+                            std::to_string(max_bytes) + "-byte limit");
+  }
+}
+
+/**
+ * @brief Adds the width-limb count at from into the one at to.
+ * @return The new top limb of to.
+ */
+auto AddCount(uint64_t* to, const uint64_t* from, size_t width) -> uint64_t {
+  uint64_t carry = 0;
+  for (size_t limb = 0; limb < width; ++limb) {
+    uint64_t addend = from[limb];
+    uint64_t sum = to[limb] + addend;
+    uint64_t next_carry = sum < addend ? 1 : 0;
+    to[limb] = sum + carry;
+    next_carry |= to[limb] < carry ? 1 : 0;
+    carry = next_carry;
+  }
+  return to[width - 1];
+}
+
+}  // namespace
+
+PartitionCounter::PartitionCounter(size_t max_table_bytes)
+    : max_table_bytes_(max_table_bytes) {}
+
+auto PartitionCounter::CountMemory(const PartitionInstance& instance)
+    -> uint64_t {
+  if (instance.size() == 0) {
+    return 0;
+  }
+  // A count is at most 2^(n - 1), so cells end up at most n / 64 + 1
+  // limbs wide, and widening to w limbs holds the (w - 1)-limb table next
+  // to the new one.
+  uint64_t cells = static_cast<uint64_t>(instance.total_sum() / 2) + 1;
+  uint64_t width = (instance.size() - 1) / 64 + 1;
+  return TableBytes(cells, width == 1 ? 1 : 2 * width - 1);
+}
+
+auto PartitionCounter::EnumerateMemory(const PartitionInstance& instance)
+    -> uint64_t {
+  if (instance.size() == 0) {
+    return 0;
+  }
+  uint64_t words = static_cast<uint64_t>(instance.total_sum() / 2) / 64 + 1;
+  return TableBytes(std::max<uint64_t>(instance.size() - 1, 1), words);
+}
+
+auto PartitionCounter::Count(const PartitionInstance& instance) const
+    -> WideUnsigned {
+  PARTITION_METRICS_PHASE(kSolve);
+  if (!instance.IsValid() || instance.total_sum() % 2 != 0 ||
+      PartitionFilter(1).Check(instance)) {
+    return WideUnsigned();
+  }
+  CheckTable(CountMemory(instance), max_table_bytes_, "Counting table");
+  auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+  const auto& elements = instance.elements();
+  // The first element is on the counted side, so count the subsets of the
+  // others that complete it.
+  uint64_t goal = target - elements[0].size();
+  size_t width = 1;
+  std::vector<uint64_t> counts(goal + 1, 0);
+  counts[0] = 1;
+  uint64_t reach = 0;
+  uint64_t top_limbs = 0;
+  for (size_t i = 1; i < elements.size(); ++i) {
+    uint64_t size = elements[i].size();
+    if (size > goal) {
+      continue;
+    }
+    // A count at most doubles per element, so it only overflows its
+    // width once some top limb has its high bit set.
+    if (top_limbs >> 63 != 0) {
+      std::vector<uint64_t> wider((goal + 1) * (width + 1), 0);
+      for (uint64_t s = 0; s <= goal; ++s) {
+        std::copy_n(counts.begin() + static_cast<ptrdiff_t>(s * width), width,
+                    wider.begin() + static_cast<ptrdiff_t>(s * (width + 1)));
+      }
+      counts = std::move(wider);
+      ++width;
+      top_limbs = 0;
+    }
+    reach = std::min(goal, reach + size);
+    if (width == 1) {
+      for (uint64_t s = reach + 1; s-- > size;) {
+        counts[s] += counts[s - size];
+        top_limbs |= counts[s];
+      }
+    } else {
+      for (uint64_t s = reach + 1; s-- > size;) {
+        top_limbs |= AddCount(&counts[s * width], &counts[(s - size) * width],
+                              width);
+      }
+    }
+  }
+  return WideUnsigned::FromLimbs(std::vector<uint64_t>(
+      counts.begin() + static_cast<ptrdiff_t>(goal * width),
+      counts.begin() + static_cast<ptrdiff_t>((goal + 1) * width)));
+}
+
+auto PartitionCounter::Enumerate(const PartitionInstance& instance) const
+    -> Generator<std::set<std::string>> {
+  if (!instance.IsValid() || instance.total_sum() % 2 != 0) {
+    co_return;
+  }
+  CheckTable(EnumerateMemory(instance), max_table_bytes_,
+             "Enumeration table");
+  auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+  const auto& elements = instance.elements();
+  if (elements[0].size() > target) {
+    co_return;
+  }
+  // Items are the elements after the first; rows[j] holds the sums
+  // reachable with items [0, j).
+  uint64_t goal = target - elements[0].size();
+  size_t items = elements.size() - 1;
+  size_t words = goal / 64 + 1;
+  std::vector<uint64_t> rows(std::max<size_t>(items, 1) * words, 0);
+  rows[0] = 1;
+  for (size_t j = 1; j < items; ++j) {
+    const uint64_t* from = &rows[(j - 1) * words];
+    uint64_t* to = &rows[j * words];
+    uint64_t size = elements[j].size();
+    std::copy_n(from, words, to);
+    if (size > goal) {
+      continue;
+    }
+    size_t word_shift = size / 64;
+    size_t bit_shift = size % 64;
+    for (size_t w = word_shift; w < words; ++w) {
+      uint64_t shifted = from[w - word_shift] << bit_shift;
+      if (bit_shift != 0 && w > word_shift) {
+        shifted |= from[w - word_shift - 1] >> (64 - bit_shift);
+      }
+      to[w] |= shifted;
+    }
+  }
+  auto reachable = [&](size_t row, uint64_t sum) {
+    return ((rows[row * words + sum / 64] >> (sum % 64)) & 1) != 0;
+  };
+
+  // Depth-first over the items from the last one down. Level l decides
+  // item l - 1; tried[l] is 0 on arrival, 1 after skipping it, 2 after
+  // taking it and 3 when taking was impossible. Both branches are only
+  // entered when the items below can still make up the remainder.
+  std::vector<uint8_t> tried(items + 1, 0);
+  std::vector<bool> taken(items, false);
+  size_t level = items;
+  uint64_t remaining = goal;
+  while (level <= items) {
+    if (level == 0) {
+      if (remaining == 0) {
+        std::set<std::string> split;
+        split.emplace(elements[0].id());
+        for (size_t item = 0; item < items; ++item) {
+          if (taken[item]) {
+            split.emplace(elements[item + 1].id());
+          }
+        }
+        co_yield split;
+      }
+      level = 1;
+      continue;
+    }
+    size_t item = level - 1;
+    uint64_t size = elements[level].size();
+    auto& state = tried[level];
+    if (state == 0) {
+      state = 1;
+      if (reachable(item, remaining)) {
+        tried[--level] = 0;
+        continue;
+      }
+    }
+    if (state == 1) {
+      state = 3;
+      if (size <= remaining && reachable(item, remaining - size)) {
+        state = 2;
+        remaining -= size;
+        taken[item] = true;
+        tried[--level] = 0;
+        continue;
+      }
+    }
+    if (state == 2) {
+      remaining += size;
+      taken[item] = false;
+    }
+    ++level;
+  }
+}
+
+}  // namespace partition
@@ -0,0 +1,129 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionFilter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/partition_filter.h"
+#include "util/metrics.h"
+#include "util/parallel_for.h"
+
+#include <bitset>
+#include <numeric>
+#include <vector>
+
+namespace partition {
+
+namespace {
+
+/// Below this many element-moduli the threads cost more than the DPs.
+constexpr size_t kParallelWork = size_t{1} << 16;
+
+using Residues = std::bitset<PartitionFilter::kMaxModulus>;
+
+/**
+ * @brief true if some subset of the sizes adds up to target modulo m.
+ */
+auto ResidueReachable(const std::vector<uint64_t>& sizes, uint64_t target,
+                      uint32_t modulus) -> bool {
+  Residues all;
+  for (uint32_t r = 0; r < modulus; ++r) {
+    all.set(r);
+  }
+  Residues reachable;
+  reachable.set(0);
+  for (uint64_t size : sizes) {
+    auto shift = static_cast<size_t>(size % modulus);
+    if (shift == 0) {
+      continue;
+    }
+    // Cyclic shift by size within the low m bits.
+    reachable |= ((reachable << shift) | (reachable >> (modulus - shift))) &
+                 all;
+    if (reachable == all) {
+      return true;
+    }
+  }
+  return reachable.test(target % modulus);
+}
+
+}  // namespace
+
+auto PartitionRejection::ReasonName(Reason reason) -> const char* {
+  switch (reason) {
+    case Reason::kOddTotal:
+      return "odd_total";
+    case Reason::kElementTooLarge:
+      return "element_too_large";
+    case Reason::kCommonDivisor:
+      return "common_divisor";
+    case Reason::kResidue:
+      return "residue";
+  }
+  return "unknown";
+}
+
+PartitionFilter::PartitionFilter(size_t threads) : threads_(threads) {}
+
+auto PartitionFilter::Check(const PartitionInstance& instance) const
+    -> std::optional<PartitionRejection> {
+  using Reason = PartitionRejection::Reason;
+  auto total = static_cast<uint64_t>(instance.total_sum());
+  if (total % 2 != 0) {
+    return PartitionRejection{
+        Reason::kOddTotal,
+        "The total " + std::to_string(total) + " is odd"};
+  }
+  uint64_t target = total / 2;
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  uint64_t divisor = 0;
+  for (const auto& element : instance.elements()) {
+    if (element.size() > target) {
+      return PartitionRejection{
+          Reason::kElementTooLarge,
+          "Element " + std::string(element.id()) + " of size " +
+              std::to_string(element.size()) + " exceeds half the total, " +
+              std::to_string(target)};
+    }
+    if (divisor != 1) {
+      divisor = std::gcd(divisor, element.size());
+    }
+    sizes.push_back(element.size());
+  }
+  if (divisor > 1 && target % divisor != 0) {
+    return PartitionRejection{
+        Reason::kCommonDivisor,
+        "Every size is a multiple of " + std::to_string(divisor) +
+            ", but half the total, " + std::to_string(target) +
+            ", is not"};
+  }
+
+  const auto& moduli = kDefaultModuli;
+  std::array<bool, kDefaultModuli.size()> reachable;
+  reachable.fill(true);
+  size_t threads =
+      sizes.size() * moduli.size() < kParallelWork ? 1 : threads_;
+  ParallelFor(moduli.size(), threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      reachable[i] = ResidueReachable(sizes, target, moduli[i]);
+    }
+  });
+  for (size_t i = 0; i < moduli.size(); ++i) {
+    if (!reachable[i]) {
+      return PartitionRejection{
+          Reason::kResidue,
+          "No subset sum is congruent to half the total, " +
+              std::to_string(target) + ", modulo " +
+              std::to_string(moduli[i])};
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace partition
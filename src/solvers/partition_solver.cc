@@ -0,0 +1,871 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for PartitionSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/partition_solver.h"
+#include "solvers/instance_features.h"
+#include "solvers/local_search_solver.h"
+#include "solvers/solver_cost_model.h"
+#include "solvers/sumset_subset_sum.h"
+#include "util/metrics.h"
+#include "util/parallel_for.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+
+namespace partition {
+
+namespace {
+
+/// Words per block of the parallel bitset pass: 32 KiB read and 32 KiB
+/// written per step stay in L2.
+constexpr size_t kBlockWords = 4096;
+
+/// Elements a block of the parallel pass has finished, alone on its cache
+/// line so that neighbouring blocks do not contend.
+struct alignas(64) BlockProgress {
+  std::atomic<size_t> done{0};
+};
+
+/**
+ * @brief dst[lo, hi) = src | src << size over those words.
+ */
+auto ShiftOrBlock(const uint64_t* src, uint64_t* dst, size_t lo, size_t hi,
+                  uint64_t size) -> void {
+  size_t word_shift = size / 64;
+  size_t bit_shift = size % 64;
+  size_t i = lo;
+  for (; i < hi && i < word_shift; ++i) {
+    dst[i] = src[i];
+  }
+  if (i < hi && i == word_shift) {
+    dst[i] = src[i] | (src[0] << bit_shift);
+    ++i;
+  }
+  // Split by bit_shift so that neither loop shifts by 64 and both
+  // vectorize.
+  if (bit_shift == 0) {
+    for (; i < hi; ++i) {
+      dst[i] = src[i] | src[i - word_shift];
+    }
+  } else {
+    for (; i < hi; ++i) {
+      dst[i] = src[i] | (src[i - word_shift] << bit_shift) |
+               (src[i - word_shift - 1] >> (64 - bit_shift));
+    }
+  }
+}
+
+/**
+ * @brief Shift-or pass over every size, with the words sliced into blocks
+ * of kBlockWords and each thread owning a contiguous run of blocks.
+ *
+ * Step e reads buffer e % 2 and writes buffer (e + 1) % 2, so a block
+ * never reads words another thread is rewriting in the same step. There
+ * is no barrier between steps: block b may take step e once the blocks it
+ * reads (b and the one or two size / 64 words below it) have finished
+ * step e - 1, and once the blocks that read b in step e - 1 are past it,
+ * since step e overwrites what they read. Both sets are at most three
+ * blocks, so threads run up to a step apart in a wavefront instead of
+ * meeting after every element.
+ */
+auto ShiftOrParallel(std::pmr::vector<uint64_t>& bits,
+                     const std::vector<uint64_t>& shifts, size_t threads,
+                     std::pmr::memory_resource* resource) -> void {
+  size_t words = bits.size();
+  size_t blocks = (words + kBlockWords - 1) / kBlockWords;
+  std::pmr::vector<uint64_t> other(words, 0, resource);
+  std::array<uint64_t*, 2> buffers = {bits.data(), other.data()};
+  std::vector<BlockProgress> progress(blocks);
+  auto wait = [&](size_t first_word, size_t last_word, size_t steps) {
+    for (size_t b = first_word / kBlockWords; b <= last_word / kBlockWords;
+         ++b) {
+      for (size_t spins = 0; progress[b].done.load(std::memory_order_acquire) <
+                             steps;
+           ++spins) {
+        if (spins >= 64) {
+          std::this_thread::yield();
+        }
+      }
+    }
+  };
+  ParallelFor(blocks, threads, [&](size_t first, size_t last) {
+    for (size_t e = 0; e < shifts.size(); ++e) {
+      const uint64_t* src = buffers[e % 2];
+      uint64_t* dst = buffers[(e + 1) % 2];
+      size_t word_shift = shifts[e] / 64;
+      for (size_t b = first; b < last; ++b) {
+        size_t lo = b * kBlockWords;
+        size_t hi = std::min(lo + kBlockWords, words);
+        if (hi > word_shift) {
+          // Reads of src below the block: words [lo - ws - 1, hi - ws).
+          size_t low = std::max(lo, word_shift + 1) - word_shift - 1;
+          wait(low, hi - 1 - word_shift, e);
+        }
+        if (e > 0) {
+          // Step e - 1 read this block's words into words up to
+          // size / 64 + 1 above them.
+          size_t previous_shift = shifts[e - 1] / 64;
+          if (lo + previous_shift < words) {
+            wait(lo + previous_shift,
+                 std::min(hi + previous_shift, words - 1), e);
+          }
+        }
+        ShiftOrBlock(src, dst, lo, hi, shifts[e]);
+        progress[b].done.store(e + 1, std::memory_order_release);
+      }
+    }
+  });
+  if (shifts.size() % 2 == 1) {
+    bits.swap(other);
+  }
+}
+
+/**
+ * @brief Bitset of the subset sums (up to limit) reachable with the sizes
+ * of the given elements.
+ * @param threads Threads for the shift-or pass; bitsets with fewer than
+ * two blocks per thread use fewer threads, down to an in-place pass on
+ * the caller.
+ */
+auto ReachableSums(const std::vector<uint64_t>& sizes,
+                   const std::vector<size_t>& elements, size_t begin,
+                   size_t end, uint64_t limit, size_t threads,
+                   std::pmr::memory_resource* resource)
+    -> std::pmr::vector<uint64_t> {
+  size_t words = limit / 64 + 1;
+  std::pmr::vector<uint64_t> bits(words, 0, resource);
+  bits[0] = 1;
+  std::vector<uint64_t> shifts;
+  uint64_t words_touched = 0;
+  for (size_t e = begin; e < end; ++e) {
+    uint64_t size = sizes[elements[e]];
+    if (size != 0 && size <= limit) {
+      shifts.push_back(size);
+      words_touched += words - size / 64;
+    }
+  }
+  threads = std::min(ResolveThreads(threads), words / kBlockWords / 2);
+  if (threads > 1) {
+    ShiftOrParallel(bits, shifts, threads, resource);
+  } else {
+    for (uint64_t size : shifts) {
+      size_t word_shift = size / 64;
+      size_t bit_shift = size % 64;
+      for (size_t i = words; i-- > word_shift;) {
+        uint64_t shifted = bits[i - word_shift] << bit_shift;
+        if (bit_shift != 0 && i > word_shift) {
+          shifted |= bits[i - word_shift - 1] >> (64 - bit_shift);
+        }
+        bits[i] |= shifted;
+      }
+    }
+  }
+  if (limit % 64 != 63) {
+    bits.back() &= (uint64_t{1} << (limit % 64 + 1)) - 1;
+  }
+  PARTITION_METRICS_COUNT(kDpWordsTouched, words_touched);
+  return bits;
+}
+
+auto TestBit(const std::pmr::vector<uint64_t>& bits, uint64_t index) -> bool {
+  return (bits[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * @brief Finds a subset of elements[begin, end) with the given sum.
+ *
+ * Splits the range in halves, combines the reachable sums of both halves
+ * to pick how much each one contributes, and recurses. Memory stays at a
+ * few bitsets instead of one row per element.
+ */
+auto FindSubsetInRange(const std::vector<uint64_t>& sizes,
+                       const std::vector<size_t>& elements, size_t begin,
+                       size_t end, uint64_t target, std::vector<size_t>& out,
+                       size_t threads, std::pmr::memory_resource* resource)
+    -> bool {
+  if (target == 0) {
+    return true;
+  }
+  if (end - begin == 1) {
+    if (sizes[elements[begin]] == target) {
+      out.push_back(elements[begin]);
+      return true;
+    }
+    return false;
+  }
+  size_t middle = begin + (end - begin) / 2;
+  auto left = ReachableSums(sizes, elements, begin, middle, target, threads,
+                            resource);
+  auto right = ReachableSums(sizes, elements, middle, end, target, threads,
+                             resource);
+  for (uint64_t left_sum = 0; left_sum <= target; ++left_sum) {
+    if (TestBit(left, left_sum) && TestBit(right, target - left_sum)) {
+      left = std::pmr::vector<uint64_t>(resource);
+      right = std::pmr::vector<uint64_t>(resource);
+      return FindSubsetInRange(sizes, elements, begin, middle, left_sum, out,
+                               threads, resource) &&
+             FindSubsetInRange(sizes, elements, middle, end,
+                               target - left_sum, out, threads, resource);
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Equal sizes as binary-split bundles: bundle b takes copies[b]
+ * elements of the group starting at group_first[b] in order.
+ */
+struct Bundles {
+  std::vector<size_t> order;
+  std::vector<uint64_t> sizes;
+  std::vector<size_t> group_first;
+  std::vector<size_t> copies;
+};
+
+auto MakeBundles(const std::vector<uint64_t>& sizes, uint64_t target)
+    -> Bundles {
+  Bundles bundles;
+  auto& order = bundles.order;
+  order.resize(sizes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return sizes[a] < sizes[b]; });
+  for (size_t first = 0, last = 0; first < order.size(); first = last) {
+    uint64_t size = sizes[order[first]];
+    while (last < order.size() && sizes[order[last]] == size) {
+      ++last;
+    }
+    if (size == 0 || size > target) {
+      continue;
+    }
+    // No more than target / size copies fit, however many there are.
+    size_t remaining = std::min<uint64_t>(last - first, target / size);
+    for (size_t bundle = 1; remaining > 0; bundle *= 2) {
+      size_t take = std::min(bundle, remaining);
+      bundles.sizes.push_back(size * take);
+      bundles.group_first.push_back(first);
+      bundles.copies.push_back(take);
+      remaining -= take;
+    }
+  }
+  return bundles;
+}
+
+/**
+ * @brief Largest set bit of bits, which always has bit 0.
+ */
+auto HighestBit(std::span<const uint64_t> bits) -> uint64_t {
+  for (size_t i = bits.size(); i-- > 0;) {
+    if (bits[i] != 0) {
+      return 64 * i + 63 - static_cast<uint64_t>(std::countl_zero(bits[i]));
+    }
+  }
+  return 0;
+}
+
+auto IdsOf(const PartitionInstance& instance,
+           const std::vector<size_t>& indices) -> std::set<std::string> {
+  std::set<std::string> ids;
+  for (size_t index : indices) {
+    ids.emplace(instance.elements()[index].id());
+  }
+  return ids;
+}
+
+}  // namespace
+
+auto FindSubsetWithSum(const std::vector<uint64_t>& sizes, uint64_t target,
+                       std::pmr::memory_resource* resource, size_t threads)
+    -> std::optional<std::vector<size_t>> {
+  std::vector<size_t> elements(sizes.size());
+  std::iota(elements.begin(), elements.end(), 0);
+  std::vector<size_t> chosen;
+  if (elements.empty() ||
+      !FindSubsetInRange(sizes, elements, 0, elements.size(), target, chosen,
+                         threads, resource)) {
+    return std::nullopt;
+  }
+  return chosen;
+}
+
+auto FindMultisetWithSum(const std::vector<uint64_t>& sizes, uint64_t target,
+                         std::pmr::memory_resource* resource, size_t threads)
+    -> std::optional<std::vector<size_t>> {
+  if (target == 0) {
+    return std::vector<size_t>{};
+  }
+  auto bundles = MakeBundles(sizes, target);
+  auto picked = FindSubsetWithSum(bundles.sizes, target, resource, threads);
+  if (!picked) {
+    return std::nullopt;
+  }
+  // Bundles of one group are disjoint runs of copies, so they can take
+  // the group's elements one after another.
+  std::vector<size_t> used(sizes.size(), 0);
+  std::vector<size_t> chosen;
+  for (size_t bundle : *picked) {
+    size_t first = bundles.group_first[bundle];
+    for (size_t i = 0; i < bundles.copies[bundle]; ++i) {
+      chosen.push_back(bundles.order[first + used[first]++]);
+    }
+  }
+  return chosen;
+}
+
+auto MakePartitionSplit(const PartitionInstance& instance,
+                        const std::vector<size_t>& indices, bool exact)
+    -> PartitionSplit {
+  const auto& elements = instance.elements();
+  auto total = static_cast<uint64_t>(instance.total_sum());
+  std::vector<bool> in_side(elements.size(), false);
+  uint64_t side_sum = 0;
+  for (size_t index : indices) {
+    in_side[index] = true;
+    side_sum += elements[index].size();
+  }
+  // The heavier side is given sometimes; the split stores the lighter.
+  bool lighter = 2 * side_sum <= total;
+  PartitionSplit split;
+  for (size_t i = 0; i < elements.size(); ++i) {
+    if (in_side[i] == lighter) {
+      split.subset.emplace(elements[i].id());
+    }
+  }
+  split.subset_sum = lighter ? side_sum : total - side_sum;
+  split.difference = total - 2 * split.subset_sum;
+  split.optimal = exact || split.difference == total % 2;
+  return split;
+}
+
+PartitionSolver::PartitionSolver(Algorithm algo,
+                                 std::pmr::memory_resource* resource)
+    : algorithm_(algo), resource_(resource), last_algorithm_(algo) {}
+
+auto PartitionSolver::Solve(const PartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  PARTITION_METRICS_PHASE(kSolve);
+  last_rejection_.reset();
+  last_local_search_ = false;
+  if (!instance.IsValid() || instance.total_sum() % 2 != 0) {
+    return std::nullopt;
+  }
+  if (filter_enabled_) {
+    last_rejection_ = filter_.Check(instance);
+    if (last_rejection_) {
+      PARTITION_METRICS_COUNT(kFilterRejections, 1);
+      return std::nullopt;
+    }
+  }
+  if (algorithm_ == Algorithm::kAuto) {
+    return SolveAuto(instance);
+  }
+  return SolveWith(algorithm_, instance);
+}
+
+auto PartitionSolver::SolveWith(Algorithm algorithm,
+                                const PartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  last_algorithm_ = algorithm;
+  switch (algorithm) {
+    case Algorithm::kDynamicProgramming:
+      return SolveDynamicProgramming(instance, false);
+    case Algorithm::kMultisetDynamicProgramming:
+      return SolveDynamicProgramming(instance, true);
+    case Algorithm::kSumsetConvolution:
+      return SolveSumset(instance);
+    case Algorithm::kBacktracking:
+      return SolveBacktracking(instance);
+    case Algorithm::kGreedyHeuristic:
+      return SolveGreedy(instance);
+    case Algorithm::kAuto:
+      return SolveAuto(instance);
+  }
+  return std::nullopt;
+}
+
+auto PartitionSolver::SolveAuto(const PartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  SolverCostModel built_in;
+  const auto& model = cost_model_ ? *cost_model_ : built_in;
+  auto features = ExtractFeatures(instance);
+  auto plan = model.Plan(features);
+  for (size_t i = 0; i < plan.size(); ++i) {
+    if (plan[i] == Algorithm::kGreedyHeuristic) {
+      if (auto solution = SolveWith(plan[i], instance)) {
+        return solution;
+      }
+      continue;
+    }
+    try {
+      if (plan[i] == Algorithm::kBacktracking && i + 1 < plan.size()) {
+        // Cheap only if a split exists: give it the time of the next
+        // engine, which also settles instances without one.
+        last_algorithm_ = plan[i];
+        return SolveBacktracking(
+            instance, model.BacktrackingBudget(plan[i + 1], features));
+      }
+      return SolveWith(plan[i], instance);
+    } catch (const std::length_error&) {
+      if (i + 1 == plan.size()) {
+        throw;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+auto PartitionSolver::Resolve(const PartitionInstance& instance) const
+    -> Algorithm {
+  if (algorithm_ != Algorithm::kAuto) {
+    return algorithm_;
+  }
+  auto features = ExtractFeatures(instance);
+  return cost_model_ ? cost_model_->Choose(features)
+                     : SolverCostModel().Choose(features);
+}
+
+auto PartitionSolver::PreferLocalSearch(
+    const PartitionInstance& instance) const -> bool {
+  if (algorithm_ != Algorithm::kAuto || local_search_budget_ms_ <= 0 ||
+      !instance.IsValid()) {
+    return false;
+  }
+  auto features = ExtractFeatures(instance);
+  SolverCostModel fallback;
+  const auto& model = cost_model_ ? *cost_model_ : fallback;
+  auto cost = model.Estimate(model.Choose(features), features, true);
+  return !cost || *cost > local_search_budget_ms_;
+}
+
+auto PartitionSolver::GetAlgorithmName() const -> std::string {
+  if (last_local_search_) {
+    return AlgorithmName(algorithm_) + " (Local Search)";
+  }
+  if (algorithm_ == Algorithm::kAuto && last_algorithm_ != Algorithm::kAuto) {
+    return AlgorithmName(algorithm_) + " (" + AlgorithmName(last_algorithm_) +
+           ")";
+  }
+  return AlgorithmName(algorithm_);
+}
+
+auto PartitionSolver::AlgorithmName(Algorithm algorithm) -> std::string {
+  switch (algorithm) {
+    case Algorithm::kDynamicProgramming:
+      return "Dynamic Programming";
+    case Algorithm::kMultisetDynamicProgramming:
+      return "Multiset Dynamic Programming";
+    case Algorithm::kSumsetConvolution:
+      return "Sumset Convolution";
+    case Algorithm::kBacktracking:
+      return "Backtracking";
+    case Algorithm::kGreedyHeuristic:
+      return "Greedy Heuristic";
+    case Algorithm::kAuto:
+      return "Automatic";
+  }
+  return "Unknown";
+}
+
+auto PartitionSolver::SolveMinimumDifference(
+    const PartitionInstance& instance) -> PartitionSplit {
+  last_local_search_ = PreferLocalSearch(instance);
+  if (last_local_search_) {
+    LocalSearchOptions options;
+    options.threads = dp_threads_;
+    options.time_budget_ms = local_search_budget_ms_;
+    return LocalSearchSolver(options).SolveMinimumDifference(instance);
+  }
+  PARTITION_METRICS_PHASE(kSolve);
+  std::vector<size_t> chosen;
+  auto algorithm = algorithm_;
+  if (instance.IsValid()) {
+    algorithm = Resolve(instance);
+    last_algorithm_ = algorithm;
+    switch (algorithm) {
+      case Algorithm::kDynamicProgramming:
+        chosen = MinimumDifferenceDynamicProgramming(instance, false);
+        break;
+      case Algorithm::kMultisetDynamicProgramming:
+        chosen = MinimumDifferenceDynamicProgramming(instance, true);
+        break;
+      case Algorithm::kSumsetConvolution:
+        chosen = MinimumDifferenceSumset(instance);
+        break;
+      case Algorithm::kBacktracking:
+        chosen = MinimumDifferenceBacktracking(instance);
+        break;
+      case Algorithm::kGreedyHeuristic:
+      case Algorithm::kAuto:
+        chosen = GreedySplit(instance);
+        break;
+    }
+  }
+  return MakePartitionSplit(instance, chosen,
+                            algorithm != Algorithm::kGreedyHeuristic);
+}
+
+auto PartitionSolver::EstimateMemory(const PartitionInstance& instance) const
+    -> size_t {
+  size_t n = instance.size();
+  switch (Resolve(instance)) {
+    case Algorithm::kDynamicProgramming:
+    case Algorithm::kMultisetDynamicProgramming: {
+      // Sizes and indices, plus the two top-level bitsets and, for a
+      // parallel pass, the second buffer of the one being built; deeper
+      // levels run after those are released and use smaller targets.
+      auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+      size_t words = target / 64 + 1;
+      size_t bitsets =
+          std::min(ResolveThreads(dp_threads_), words / kBlockWords / 2) > 1
+              ? 3
+              : 2;
+      return n * (sizeof(uint64_t) + 2 * sizeof(size_t)) +
+             bitsets * words * sizeof(uint64_t);
+    }
+    case Algorithm::kSumsetConvolution: {
+      // Two transforms of the top sumset, plus a few bitsets per level.
+      auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+      auto levels = static_cast<size_t>(std::bit_width(n));
+      return n * (sizeof(uint64_t) + 2 * sizeof(size_t)) +
+             2 * std::bit_ceil(2 * target + 1) * sizeof(uint32_t) +
+             2 * levels * (target / 64 + 1) * sizeof(uint64_t);
+    }
+    case Algorithm::kBacktracking:
+      // Order, groups, suffix sums and counts per element at worst, plus
+      // the transposition table.
+      return n * (2 * sizeof(size_t) + sizeof(SizeGroup) + sizeof(int64_t)) +
+             (transposition_entries_ == 0
+                  ? 0
+                  : TranspositionTable::BytesFor(transposition_entries_));
+    case Algorithm::kGreedyHeuristic:
+    case Algorithm::kAuto:
+      return n * sizeof(size_t);
+  }
+  return 0;
+}
+
+auto PartitionSolver::SetTranspositionEntries(size_t entries) -> void {
+  transposition_entries_ = entries;
+  if (entries == 0) {
+    table_.reset();
+  }
+}
+
+auto PartitionSolver::SolveDynamicProgramming(
+    const PartitionInstance& instance, bool multiset)
+    -> std::optional<std::set<std::string>> {
+  auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+  if (target > kMaxDynamicProgrammingTarget) {
+    throw std::length_error("Target sum " + std::to_string(target) +
+                            " is too large for dynamic programming");
+  }
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.push_back(element.size());
+  }
+  auto chosen =
+      multiset ? FindMultisetWithSum(sizes, target, resource_, dp_threads_)
+               : FindSubsetWithSum(sizes, target, resource_, dp_threads_);
+  if (!chosen) {
+    return std::nullopt;
+  }
+  return IdsOf(instance, *chosen);
+}
+
+auto PartitionSolver::SolveSumset(const PartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.push_back(element.size());
+  }
+  auto chosen = FindSubsetWithSumConvolution(
+      sizes, static_cast<uint64_t>(instance.total_sum() / 2));
+  if (!chosen) {
+    return std::nullopt;
+  }
+  return IdsOf(instance, *chosen);
+}
+
+auto PartitionSolver::MinimumDifferenceSumset(
+    const PartitionInstance& instance) -> std::vector<size_t> {
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.push_back(element.size());
+  }
+  auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+  uint64_t best = HighestBit(SubsetSumsConvolution(sizes, target));
+  auto chosen = FindSubsetWithSumConvolution(sizes, best);
+  return chosen ? std::move(*chosen) : std::vector<size_t>{};
+}
+
+auto PartitionSolver::MinimumDifferenceDynamicProgramming(
+    const PartitionInstance& instance, bool multiset) -> std::vector<size_t> {
+  auto target = static_cast<uint64_t>(instance.total_sum() / 2);
+  if (target > kMaxDynamicProgrammingTarget) {
+    throw std::length_error("Target sum " + std::to_string(target) +
+                            " is too large for dynamic programming");
+  }
+  std::vector<uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.push_back(element.size());
+  }
+  uint64_t best = 0;
+  {
+    // One pass for the largest reachable sum, then the usual search for a
+    // subset with exactly that sum.
+    Bundles bundles;
+    if (multiset) {
+      bundles = MakeBundles(sizes, target);
+    }
+    const auto& pass_sizes = multiset ? bundles.sizes : sizes;
+    std::vector<size_t> all(pass_sizes.size());
+    std::iota(all.begin(), all.end(), 0);
+    best = HighestBit(
+        ReachableSums(pass_sizes, all, 0, all.size(), target, dp_threads_,
+                      resource_));
+  }
+  auto chosen =
+      multiset ? FindMultisetWithSum(sizes, best, resource_, dp_threads_)
+               : FindSubsetWithSum(sizes, best, resource_, dp_threads_);
+  return chosen ? std::move(*chosen) : std::vector<size_t>{};
+}
+
+auto PartitionSolver::SolveBacktracking(const PartitionInstance& instance,
+                                        uint64_t node_budget)
+    -> std::optional<std::set<std::string>> {
+  const auto& elements = instance.elements();
+  // The largest element can always be placed in A' by symmetry.
+  PrepareBacktracking(instance, 1);
+  auto target = instance.total_sum() / 2;
+  nodes_explored_ = 0;
+  node_budget_ = node_budget;
+  bool found = BacktrackHelper(
+      0, static_cast<int64_t>(elements[order_[0]].size()), target);
+  PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored_);
+  PARTITION_METRICS_COUNT(kTranspositionHits, table_ ? table_->hits() : 0);
+  // An exhausted budget cut branches short, so "not found" proves nothing.
+  bool exhausted =
+      !found && node_budget_ != 0 && nodes_explored_ > node_budget_;
+  std::optional<std::set<std::string>> subset;
+  if (found) {
+    subset = IdsOf(instance, BacktrackIndices(taken_, true));
+  }
+  order_.clear();
+  groups_.clear();
+  suffix_sums_.clear();
+  taken_.clear();
+  node_budget_ = 0;
+  if (exhausted) {
+    throw std::length_error("Backtracking exceeded its budget of " +
+                            std::to_string(node_budget) + " nodes");
+  }
+  return subset;
+}
+
+auto PartitionSolver::MinimumDifferenceBacktracking(
+    const PartitionInstance& instance) -> std::vector<size_t> {
+  // The lighter side need not hold the largest element, so every element
+  // is grouped.
+  PrepareBacktracking(instance, 0);
+  nodes_explored_ = 0;
+  best_sum_ = 0;
+  best_taken_.assign(groups_.size(), 0);
+  MinimizeHelper(0, 0, instance.total_sum() / 2);
+  PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored_);
+  PARTITION_METRICS_COUNT(kTranspositionHits, table_ ? table_->hits() : 0);
+  auto chosen = BacktrackIndices(best_taken_, false);
+  order_.clear();
+  groups_.clear();
+  suffix_sums_.clear();
+  taken_.clear();
+  best_taken_.clear();
+  return chosen;
+}
+
+auto PartitionSolver::PrepareBacktracking(const PartitionInstance& instance,
+                                          size_t first) -> void {
+  const auto& elements = instance.elements();
+  order_.resize(elements.size());
+  std::iota(order_.begin(), order_.end(), 0);
+  std::stable_sort(order_.begin(), order_.end(), [&](size_t a, size_t b) {
+    return elements[a].size() > elements[b].size();
+  });
+  groups_.clear();
+  for (size_t i = first; i < order_.size(); ++i) {
+    auto size = static_cast<int64_t>(elements[order_[i]].size());
+    if (groups_.empty() || groups_.back().size != size) {
+      groups_.push_back({size, i, 0});
+    }
+    ++groups_.back().count;
+  }
+  suffix_sums_.assign(groups_.size() + 1, 0);
+  for (size_t g = groups_.size(); g-- > 0;) {
+    suffix_sums_[g] = suffix_sums_[g + 1] +
+                      groups_[g].size * static_cast<int64_t>(groups_[g].count);
+  }
+  taken_.assign(groups_.size(), 0);
+  if (transposition_entries_ != 0) {
+    // Small searches get a small table; it only grows up to the limit.
+    size_t n = order_.size();
+    size_t entries = std::min(transposition_entries_,
+                              std::max<size_t>(1024, 16 * n * n));
+    if (!table_ || table_->capacity() < entries) {
+      table_ = std::make_unique<TranspositionTable>(entries);
+    }
+    table_->NewSearch();
+  }
+}
+
+auto PartitionSolver::BacktrackIndices(const std::vector<size_t>& taken,
+                                       bool with_first) const
+    -> std::vector<size_t> {
+  std::vector<size_t> indices;
+  if (with_first) {
+    indices.push_back(order_[0]);
+  }
+  for (size_t g = 0; g < groups_.size(); ++g) {
+    for (size_t i = 0; i < taken[g]; ++i) {
+      indices.push_back(order_[groups_[g].first + i]);
+    }
+  }
+  return indices;
+}
+
+auto PartitionSolver::SolveGreedy(const PartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  auto first = GreedySplit(instance);
+  int64_t first_sum = 0;
+  for (size_t index : first) {
+    first_sum += static_cast<int64_t>(instance.elements()[index].size());
+  }
+  if (2 * first_sum != instance.total_sum()) {
+    return std::nullopt;
+  }
+  return IdsOf(instance, first);
+}
+
+auto PartitionSolver::GreedySplit(const PartitionInstance& instance) const
+    -> std::vector<size_t> {
+  const auto& elements = instance.elements();
+  std::vector<size_t> order(elements.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return elements[a].size() > elements[b].size();
+  });
+  uint64_t first_sum = 0;
+  uint64_t second_sum = 0;
+  std::vector<size_t> first;
+  for (size_t index : order) {
+    if (first_sum <= second_sum) {
+      first_sum += elements[index].size();
+      first.push_back(index);
+    } else {
+      second_sum += elements[index].size();
+    }
+  }
+  return first;
+}
+
+auto PartitionSolver::BacktrackHelper(size_t group, int64_t current_sum,
+                                      int64_t target_sum) -> bool {
+  ++nodes_explored_;
+  if (current_sum == target_sum) {
+    return true;
+  }
+  if (node_budget_ != 0 && nodes_explored_ > node_budget_) {
+    return false;
+  }
+  if (current_sum > target_sum || group >= groups_.size() ||
+      current_sum + suffix_sums_[group] < target_sum) {
+    return false;
+  }
+  auto state = static_cast<uint64_t>(current_sum);
+  if (table_ && table_->Contains(static_cast<uint32_t>(group), state)) {
+    return false;
+  }
+  const auto& members = groups_[group];
+  size_t most = members.count;
+  if (members.size > 0) {
+    most = std::min<size_t>(
+        most, static_cast<size_t>((target_sum - current_sum) / members.size));
+  }
+  for (size_t take = most + 1; take-- > 0;) {
+    taken_[group] = take;
+    if (BacktrackHelper(group + 1,
+                        current_sum + members.size * static_cast<int64_t>(take),
+                        target_sum)) {
+      return true;
+    }
+  }
+  taken_[group] = 0;
+  if (table_) {
+    table_->Insert(static_cast<uint32_t>(group), state,
+                   static_cast<uint32_t>(groups_.size() - group));
+  }
+  return false;
+}
+
+auto PartitionSolver::MinimizeHelper(size_t group, int64_t current_sum,
+                                     int64_t target_sum) -> void {
+  ++nodes_explored_;
+  if (current_sum > best_sum_) {
+    best_sum_ = current_sum;
+    best_taken_ = taken_;
+  }
+  if (best_sum_ == target_sum || group >= groups_.size() ||
+      current_sum + suffix_sums_[group] <= best_sum_) {
+    return;
+  }
+  if (current_sum + suffix_sums_[group] <= target_sum) {
+    best_sum_ = current_sum + suffix_sums_[group];
+    best_taken_ = taken_;
+    for (size_t g = group; g < groups_.size(); ++g) {
+      best_taken_[g] = groups_[g].count;
+    }
+    return;
+  }
+  auto state = static_cast<uint64_t>(current_sum);
+  if (table_ && table_->Contains(static_cast<uint32_t>(group), state)) {
+    return;
+  }
+  const auto& members = groups_[group];
+  size_t most = members.count;
+  if (members.size > 0) {
+    most = std::min<size_t>(
+        most, static_cast<size_t>((target_sum - current_sum) / members.size));
+  }
+  for (size_t take = most + 1; take-- > 0;) {
+    taken_[group] = take;
+    MinimizeHelper(group + 1,
+                   current_sum + members.size * static_cast<int64_t>(take),
+                   target_sum);
+    if (best_sum_ == target_sum) {
+      return;
+    }
+  }
+  taken_[group] = 0;
+  if (table_) {
+    table_->Insert(static_cast<uint32_t>(group), state,
+                   static_cast<uint32_t>(groups_.size() - group));
+  }
+}
+
+}  // namespace partition
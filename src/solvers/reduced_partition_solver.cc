@@ -0,0 +1,111 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for ReducedPartitionSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/reduced_partition_solver.h"
+#include "util/metrics.h"
+
+#include <limits>
+
+namespace partition {
+
+auto ReducedPartitionSolver::Solve(const ReducedPartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  PARTITION_METRICS_PHASE(kSolve);
+  instance_ = &instance;
+  nodes_explored_ = 0;
+  auto slots = 3 * instance.q();
+  elements_by_slot_.assign(slots, {});
+  for (size_t i = 0; i < instance.triple_count(); ++i) {
+    for (uint32_t position : instance.positions(i)) {
+      elements_by_slot_[position / instance.p()].push_back(i);
+    }
+  }
+  std::vector<bool> covered(slots, false);
+  std::vector<size_t> chosen;
+  chosen.reserve(instance.q());
+  std::optional<std::set<std::string>> solution;
+  if (Search(covered, slots, chosen)) {
+    solution.emplace();
+    solution->insert(instance.ElementId(instance.triple_count()));  // b1
+    for (size_t element : chosen) {
+      solution->insert(instance.ElementId(element));
+    }
+  }
+  PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored_);
+  instance_ = nullptr;
+  elements_by_slot_.clear();
+  return solution;
+}
+
+auto ReducedPartitionSolver::GetAlgorithmName() const -> std::string {
+  return "Exact cover over reduced bit fields";
+}
+
+auto ReducedPartitionSolver::Search(std::vector<bool>& covered,
+                                    size_t remaining,
+                                    std::vector<size_t>& chosen) -> bool {
+  ++nodes_explored_;
+  if (remaining == 0) {
+    return true;
+  }
+  // Pick the uncovered slot with the fewest usable elements.
+  size_t best_slot = 0;
+  size_t best_count = std::numeric_limits<size_t>::max();
+  for (size_t slot = 0; slot < covered.size(); ++slot) {
+    if (covered[slot]) {
+      continue;
+    }
+    size_t count = 0;
+    for (size_t element : elements_by_slot_[slot]) {
+      if (IsUsable(element, covered)) {
+        ++count;
+      }
+    }
+    if (count < best_count) {
+      best_slot = slot;
+      best_count = count;
+      if (count == 0) {
+        return false;
+      }
+    }
+  }
+  for (size_t element : elements_by_slot_[best_slot]) {
+    if (!IsUsable(element, covered)) {
+      continue;
+    }
+    auto positions = instance_->positions(element);
+    for (uint32_t position : positions) {
+      covered[position / instance_->p()] = true;
+    }
+    chosen.push_back(element);
+    if (Search(covered, remaining - 3, chosen)) {
+      return true;
+    }
+    chosen.pop_back();
+    for (uint32_t position : positions) {
+      covered[position / instance_->p()] = false;
+    }
+  }
+  return false;
+}
+
+auto ReducedPartitionSolver::IsUsable(size_t element,
+                                      const std::vector<bool>& covered) const
+    -> bool {
+  for (uint32_t position : instance_->positions(element)) {
+    if (covered[position / instance_->p()]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace partition
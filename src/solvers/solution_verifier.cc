@@ -0,0 +1,225 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for SolutionVerifier.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/solution_verifier.h"
+#include "util/metrics.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+namespace partition {
+
+namespace {
+
+using TripleKey = std::tuple<std::string_view, std::string_view, std::string_view>;
+
+auto KeyOf(const Triple& triple) -> TripleKey {
+  return {triple.w(), triple.x(), triple.y()};
+}
+
+/**
+ * @brief Collects the problems found in a 3DM matching.
+ * @return One message per problem; empty if the matching is perfect.
+ */
+auto Find3DMViolations(const ThreeDMInstance& instance,
+                       const std::vector<Triple>& matching)
+    -> std::vector<std::string> {
+  std::vector<std::string> violations;
+  if (matching.size() != instance.q()) {
+    violations.push_back("Matching has " + std::to_string(matching.size()) +
+                         " triples, expected q = " +
+                         std::to_string(instance.q()));
+  }
+  std::vector<TripleKey> available;
+  available.reserve(instance.triples().size());
+  for (const auto& triple : instance.triples()) {
+    available.push_back(KeyOf(triple));
+  }
+  std::sort(available.begin(), available.end());
+
+  std::set<std::string_view> used_w, used_x, used_y;
+  for (const auto& triple : matching) {
+    if (!std::binary_search(available.begin(), available.end(),
+                            KeyOf(triple))) {
+      violations.push_back("Triple " + triple.ToString() +
+                           " is not in M");
+    }
+    if (!used_w.insert(triple.w()).second) {
+      violations.push_back("Element " + std::string(triple.w()) +
+                           " of W is used more than once");
+    }
+    if (!used_x.insert(triple.x()).second) {
+      violations.push_back("Element " + std::string(triple.x()) +
+                           " of X is used more than once");
+    }
+    if (!used_y.insert(triple.y()).second) {
+      violations.push_back("Element " + std::string(triple.y()) +
+                           " of Y is used more than once");
+    }
+  }
+  auto report_uncovered = [&violations](const ThreeDMInstance::ElementSet& set,
+                                        const std::set<std::string_view>& used,
+                                        const std::string& name) {
+    for (const auto& element : set) {
+      if (used.find(element) == used.end()) {
+        violations.push_back("Element " + std::string(element) + " of " +
+                             name + " is not covered");
+      }
+    }
+  };
+  report_uncovered(instance.w(), used_w, "W");
+  report_uncovered(instance.x(), used_x, "X");
+  report_uncovered(instance.y(), used_y, "Y");
+  return violations;
+}
+
+struct PartitionSums {
+  bool all_ids_known = true;
+  uint64_t subset_sum = 0;
+  uint64_t complement_sum = 0;
+  std::vector<std::string> unknown_ids;
+};
+
+auto ComputePartitionSums(const PartitionInstance& instance,
+                          const std::set<std::string>& subset)
+    -> PartitionSums {
+  PartitionSums sums;
+  std::unordered_map<std::string_view, uint64_t> sizes;
+  sizes.reserve(instance.size());
+  for (const auto& element : instance.elements()) {
+    sizes.emplace(element.id(), element.size());
+  }
+  for (const auto& id : subset) {
+    auto it = sizes.find(id);
+    if (it == sizes.end()) {
+      sums.all_ids_known = false;
+      sums.unknown_ids.push_back(id);
+    } else {
+      sums.subset_sum += it->second;
+    }
+  }
+  sums.complement_sum =
+      static_cast<uint64_t>(instance.total_sum()) - sums.subset_sum;
+  return sums;
+}
+
+}  // namespace
+
+auto SolutionVerifier::Verify3DMSolution(const ThreeDMInstance& instance,
+                                         const std::vector<Triple>& matching)
+    -> bool {
+  PARTITION_METRICS_PHASE(kVerify);
+  return ThreeDMBitmapVerifier(instance).Verify(matching);
+}
+
+auto SolutionVerifier::VerifyPartitionSolution(
+    const PartitionInstance& instance, const std::set<std::string>& subset)
+    -> bool {
+  PARTITION_METRICS_PHASE(kVerify);
+  PartitionBitmapVerifier verifier(instance);
+  auto bitmap = verifier.ToBitmap(subset);
+  return bitmap && verifier.Verify(*bitmap);
+}
+
+auto SolutionVerifier::Verify3DMSolutions(
+    const ThreeDMInstance& instance,
+    const std::vector<std::vector<Triple>>& matchings, size_t threads)
+    -> std::vector<uint8_t> {
+  PARTITION_METRICS_PHASE(kVerify);
+  return ThreeDMBitmapVerifier(instance).VerifyBatch(matchings, threads);
+}
+
+auto SolutionVerifier::VerifyPartitionSolutions(
+    const PartitionInstance& instance,
+    const std::vector<std::set<std::string>>& subsets, size_t threads)
+    -> std::vector<uint8_t> {
+  PARTITION_METRICS_PHASE(kVerify);
+  return PartitionBitmapVerifier(instance).VerifyBatch(subsets, threads);
+}
+
+auto SolutionVerifier::VerifyPartitionSolution(
+    const ReducedPartitionInstance& instance,
+    const std::set<std::string>& subset) -> bool {
+  PARTITION_METRICS_PHASE(kVerify);
+  auto k = instance.triple_count();
+  std::vector<uint32_t> chosen_counts(3 * instance.q(), 0);
+  bool has_b1 = false;
+  bool has_b2 = false;
+  for (const auto& id : subset) {
+    auto index = instance.IndexOf(id);
+    if (!index) {
+      return false;
+    }
+    if (*index == k) {
+      has_b1 = true;
+    } else if (*index == k + 1) {
+      has_b2 = true;
+    } else {
+      for (uint32_t position : instance.positions(*index)) {
+        ++chosen_counts[position / instance.p()];
+      }
+    }
+  }
+  // b1 + b2 = 3T exceeds the half 2T, and without either of them the subset
+  // is at most T. With exactly one of them, the chosen a_i must add up to B
+  // (with b1) or T - B (with b2); no field can carry since counts < 2^p.
+  if (has_b1 == has_b2) {
+    return false;
+  }
+  for (size_t slot = 0; slot < chosen_counts.size(); ++slot) {
+    uint32_t expected = has_b1 ? 1 : instance.slot_count(slot) - 1;
+    if (instance.slot_count(slot) == 0 || chosen_counts[slot] != expected) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto SolutionVerifier::Get3DMVerificationReport(
+    const ThreeDMInstance& instance, const std::vector<Triple>& matching)
+    -> std::string {
+  auto violations = Find3DMViolations(instance, matching);
+  std::ostringstream report;
+  report << "3DM Verification Report:\n";
+  report << "  q: " << instance.q() << "\n";
+  report << "  Triples in M: " << instance.triples().size() << "\n";
+  report << "  Triples in matching: " << matching.size() << "\n";
+  report << "  Result: " << (violations.empty() ? "VALID" : "INVALID")
+         << "\n";
+  for (const auto& violation : violations) {
+    report << "  - " << violation << "\n";
+  }
+  return report.str();
+}
+
+auto SolutionVerifier::GetPartitionVerificationReport(
+    const PartitionInstance& instance, const std::set<std::string>& subset)
+    -> std::string {
+  auto sums = ComputePartitionSums(instance, subset);
+  std::ostringstream report;
+  report << "Partition Verification Report:\n";
+  report << "  Elements: " << instance.size() << "\n";
+  report << "  Total sum: " << instance.total_sum() << "\n";
+  report << "  Subset size: " << subset.size() << "\n";
+  report << "  Subset sum: " << sums.subset_sum << "\n";
+  report << "  Complement sum: " << sums.complement_sum << "\n";
+  for (const auto& id : sums.unknown_ids) {
+    report << "  - Unknown element id: " << id << "\n";
+  }
+  bool valid = sums.all_ids_known && sums.subset_sum == sums.complement_sum;
+  report << "  Result: " << (valid ? "VALID" : "INVALID") << "\n";
+  return report.str();
+}
+
+}  // namespace partition
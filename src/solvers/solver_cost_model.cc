@@ -0,0 +1,249 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for SolverCostModel.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/solver_cost_model.h"
+#include "solvers/sumset_subset_sum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+using Algorithm = PartitionSolver::Algorithm;
+
+constexpr std::array<Algorithm, SolverCostModel::kEngineCount> kEngines = {
+    Algorithm::kDynamicProgramming, Algorithm::kMultisetDynamicProgramming,
+    Algorithm::kSumsetConvolution, Algorithm::kBacktracking,
+    Algorithm::kGreedyHeuristic};
+
+/// Built-in milliseconds per work unit, from the solve/* bench cases.
+constexpr std::array<double, SolverCostModel::kEngineCount> kDefaultCosts = {
+    4e-6, 4.2e-6, 5.8e-6, 1.5e-5, 3.2e-5};
+
+auto EngineIndex(Algorithm algorithm) -> size_t {
+  auto found = std::find(kEngines.begin(), kEngines.end(), algorithm);
+  if (found == kEngines.end()) {
+    throw std::invalid_argument("Algorithm has no cost coefficient");
+  }
+  return static_cast<size_t>(found - kEngines.begin());
+}
+
+auto Log2(double value) -> double { return std::log2(std::max(value, 2.0)); }
+
+}  // namespace
+
+SolverCostModel::SolverCostModel() : ms_per_unit_(kDefaultCosts) {}
+
+auto SolverCostModel::LoadFromFile(const std::string& filename)
+    -> SolverCostModel {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  SolverCostModel model;
+  std::string line;
+  size_t line_number = 0;
+  while (std::getline(file, line)) {
+    ++line_number;
+    std::istringstream fields(line);
+    std::string name;
+    if (!(fields >> name) || name[0] == '#') {
+      continue;
+    }
+    double cost = 0;
+    auto engine = std::find_if(
+        kEngines.begin(), kEngines.end(),
+        [&](Algorithm algorithm) { return EngineName(algorithm) == name; });
+    if (engine == kEngines.end() || !(fields >> cost) || !(cost > 0)) {
+      throw std::runtime_error(filename + ":" + std::to_string(line_number) +
+                               ": expected '<engine> <ms per unit>'");
+    }
+    model.ms_per_unit_[EngineIndex(*engine)] = cost;
+  }
+  return model;
+}
+
+auto SolverCostModel::WriteToFile(const std::string& filename) const -> void {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  file << "# PartitionSolver cost model: milliseconds per work unit\n";
+  for (Algorithm algorithm : kEngines) {
+    file << EngineName(algorithm) << ' ' << coefficient(algorithm) << '\n';
+  }
+  if (!file) {
+    throw std::runtime_error("Could not write file: " + filename);
+  }
+}
+
+auto SolverCostModel::Work(Algorithm algorithm,
+                           const PartitionFeatures& features, bool worst_case)
+    -> std::optional<double> {
+  auto target = features.total_sum / 2;
+  auto n = static_cast<double>(features.n);
+  auto words = static_cast<double>(target / 64 + 1);
+  switch (algorithm) {
+    case Algorithm::kDynamicProgramming:
+      if (target > PartitionSolver::kMaxDynamicProgrammingTarget) {
+        return std::nullopt;
+      }
+      return n * words;
+    case Algorithm::kMultisetDynamicProgramming: {
+      if (target > PartitionSolver::kMaxDynamicProgrammingTarget) {
+        return std::nullopt;
+      }
+      // A group of c equal sizes becomes about log2(c) + 1 bundles.
+      auto distinct = static_cast<double>(std::max<size_t>(
+          features.distinct_sizes, 1));
+      return distinct * (1 + std::log2(n / distinct + 1)) * words +
+             n * Log2(n);
+    }
+    case Algorithm::kSumsetConvolution:
+      if (target > kMaxSumsetTarget) {
+        return std::nullopt;
+      }
+      return static_cast<double>(target + 1) *
+             Log2(static_cast<double>(target)) * Log2(n);
+    case Algorithm::kBacktracking: {
+      // Far past the phase transition (2^n >> n * S) the search meets a
+      // split almost at once, if there is one; otherwise, and always
+      // below it, it explores most of a tree that the size groups and the
+      // transposition table roughly halve in depth.
+      double log_sums = Log2(n) + Log2(static_cast<double>(target) + 1);
+      if (!worst_case && n >= log_sums + 2) {
+        return n * Log2(n);
+      }
+      return n * std::exp2(n / 2);
+    }
+    case Algorithm::kGreedyHeuristic:
+      return n * Log2(n);
+    case Algorithm::kAuto:
+      break;
+  }
+  return std::nullopt;
+}
+
+auto SolverCostModel::Estimate(Algorithm algorithm,
+                               const PartitionFeatures& features,
+                               bool worst_case) const
+    -> std::optional<double> {
+  auto work = Work(algorithm, features, worst_case);
+  if (!work) {
+    return std::nullopt;
+  }
+  return *work * coefficient(algorithm);
+}
+
+auto SolverCostModel::Plan(const PartitionFeatures& features) const
+    -> std::vector<Algorithm> {
+  std::vector<std::pair<double, Algorithm>> exact;
+  for (Algorithm algorithm : kEngines) {
+    if (algorithm == Algorithm::kGreedyHeuristic) {
+      continue;
+    }
+    if (auto cost = Estimate(algorithm, features)) {
+      exact.emplace_back(*cost, algorithm);
+    }
+  }
+  std::stable_sort(
+      exact.begin(), exact.end(),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+  std::vector<Algorithm> plan;
+  auto greedy = Estimate(Algorithm::kGreedyHeuristic, features);
+  if (!features.reduced && greedy &&
+      *greedy < kGreedyShare * exact.front().first) {
+    plan.push_back(Algorithm::kGreedyHeuristic);
+  }
+  for (const auto& [cost, algorithm] : exact) {
+    plan.push_back(algorithm);
+  }
+  return plan;
+}
+
+auto SolverCostModel::Choose(const PartitionFeatures& features) const
+    -> Algorithm {
+  auto chosen = Algorithm::kBacktracking;
+  std::optional<double> best;
+  for (Algorithm algorithm : kEngines) {
+    if (algorithm == Algorithm::kGreedyHeuristic) {
+      continue;
+    }
+    auto cost = Estimate(algorithm, features, true);
+    if (cost && (!best || *cost < *best)) {
+      best = cost;
+      chosen = algorithm;
+    }
+  }
+  return chosen;
+}
+
+auto SolverCostModel::BacktrackingBudget(
+    Algorithm next, const PartitionFeatures& features) const -> uint64_t {
+  auto cost = Estimate(next, features);
+  if (!cost) {
+    return kMinBacktrackingBudget;
+  }
+  double nodes = *cost / coefficient(Algorithm::kBacktracking);
+  return nodes >= 1e18 ? uint64_t{1000000000000000000}
+                       : std::max(kMinBacktrackingBudget,
+                                  static_cast<uint64_t>(nodes));
+}
+
+auto SolverCostModel::Calibrate(const std::vector<CostSample>& samples)
+    -> void {
+  for (Algorithm algorithm : kEngines) {
+    std::vector<double> ratios;
+    for (const auto& sample : samples) {
+      auto work = sample.algorithm == algorithm
+                      ? Work(algorithm, sample.features)
+                      : std::nullopt;
+      if (work && *work > 0 && sample.milliseconds > 0) {
+        ratios.push_back(sample.milliseconds / *work);
+      }
+    }
+    if (ratios.empty()) {
+      continue;
+    }
+    auto middle = ratios.begin() + static_cast<ptrdiff_t>(ratios.size() / 2);
+    std::nth_element(ratios.begin(), middle, ratios.end());
+    ms_per_unit_[EngineIndex(algorithm)] = *middle;
+  }
+}
+
+auto SolverCostModel::coefficient(Algorithm algorithm) const -> double {
+  return ms_per_unit_[EngineIndex(algorithm)];
+}
+
+auto SolverCostModel::EngineName(Algorithm algorithm) -> std::string {
+  switch (algorithm) {
+    case Algorithm::kDynamicProgramming:
+      return "dp";
+    case Algorithm::kMultisetDynamicProgramming:
+      return "multiset";
+    case Algorithm::kSumsetConvolution:
+      return "sumset";
+    case Algorithm::kBacktracking:
+      return "backtracking";
+    case Algorithm::kGreedyHeuristic:
+      return "greedy";
+    case Algorithm::kAuto:
+      return "auto";
+  }
+  return "unknown";
+}
+
+}  // namespace partition
@@ -0,0 +1,395 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the sumset subset sum engine.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/sumset_subset_sum.h"
+#include "solvers/partition_solver.h"
+#include "util/metrics.h"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace partition {
+
+namespace {
+
+using Bits = std::vector<uint64_t>;
+
+/// 15 * 2^27 + 1: transforms up to 2^27 points, and sums of two 32-bit
+/// residues still fit in 32 bits.
+constexpr uint32_t kModulus = 2013265921;
+constexpr uint32_t kGenerator = 31;
+/// Groups of at most this many elements are always leaves, solved by the
+/// bitset DP.
+constexpr size_t kLeafElements = 32;
+/// Word operations a transform butterfly is worth, to choose between
+/// shifting the sparser set and transforming both.
+constexpr uint64_t kButterflyCost = 2;
+
+auto MulMod(uint32_t a, uint32_t b) -> uint32_t {
+  return static_cast<uint32_t>(static_cast<uint64_t>(a) * b % kModulus);
+}
+
+auto PowMod(uint32_t base, uint64_t exponent) -> uint32_t {
+  uint32_t result = 1;
+  for (; exponent > 0; exponent >>= 1) {
+    if (exponent & 1) {
+      result = MulMod(result, base);
+    }
+    base = MulMod(base, base);
+  }
+  return result;
+}
+
+/**
+ * @brief -kModulus^-1 mod 2^32, by Newton iteration.
+ */
+constexpr auto MontgomeryFactor() -> uint32_t {
+  uint32_t inverse = kModulus;
+  for (int i = 0; i < 5; ++i) {
+    inverse *= 2 - kModulus * inverse;
+  }
+  return 0 - inverse;
+}
+
+constexpr uint32_t kMontgomeryFactor = MontgomeryFactor();
+/// 2^32 mod kModulus: 1 in Montgomery form.
+constexpr uint32_t kMontgomeryOne =
+    static_cast<uint32_t>((uint64_t{1} << 32) % kModulus);
+
+/**
+ * @brief value mod kModulus for value in (-kModulus, kModulus), seen as
+ * unsigned. Branch-free: the butterflies are too unpredictable for a
+ * conditional subtraction.
+ */
+auto Wrap(uint32_t value) -> uint32_t {
+  return value + ((static_cast<uint32_t>(static_cast<int32_t>(value) >> 31)) &
+                  kModulus);
+}
+
+/**
+ * @brief a * b / 2^32 mod kModulus, without a division.
+ */
+auto MontgomeryMul(uint32_t a, uint32_t b) -> uint32_t {
+  uint64_t product = static_cast<uint64_t>(a) * b;
+  uint32_t m = static_cast<uint32_t>(product) * kMontgomeryFactor;
+  auto reduced = static_cast<uint32_t>(
+      (product + static_cast<uint64_t>(m) * kModulus) >> 32);
+  return Wrap(reduced - kModulus);
+}
+
+/**
+ * @brief In-place iterative number-theoretic transform of values in
+ * Montgomery form; values.size() must be a power of two. The inverse
+ * skips the division by the length, which only scales the result.
+ */
+auto Transform(std::vector<uint32_t>& values, bool inverse) -> void {
+  size_t n = values.size();
+  for (size_t i = 1, j = 0; i < n; ++i) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(values[i], values[j]);
+    }
+  }
+  std::vector<uint32_t> roots;
+  for (size_t length = 2; length <= n; length <<= 1) {
+    uint32_t step = PowMod(kGenerator, (kModulus - 1) / length);
+    if (inverse) {
+      step = PowMod(step, kModulus - 2);
+    }
+    step = MulMod(step, kMontgomeryOne);
+    size_t half = length / 2;
+    roots.resize(half);
+    roots[0] = kMontgomeryOne;
+    for (size_t k = 1; k < half; ++k) {
+      roots[k] = MontgomeryMul(roots[k - 1], step);
+    }
+    for (size_t i = 0; i < n; i += length) {
+      uint32_t* low = values.data() + i;
+      uint32_t* high = low + half;
+      for (size_t k = 0; k < half; ++k) {
+        uint32_t u = low[k];
+        uint32_t v = MontgomeryMul(high[k], roots[k]);
+        low[k] = Wrap(u + v - kModulus);
+        high[k] = Wrap(u - v);
+      }
+    }
+  }
+}
+
+auto TestBit(const Bits& bits, uint64_t index) -> bool {
+  return index / 64 < bits.size() && ((bits[index / 64] >> (index % 64)) & 1);
+}
+
+/**
+ * @brief Largest set bit; every set here holds 0.
+ */
+auto Highest(const Bits& bits) -> uint64_t {
+  for (size_t i = bits.size(); i-- > 0;) {
+    if (bits[i] != 0) {
+      return 64 * i + 63 - static_cast<uint64_t>(std::countl_zero(bits[i]));
+    }
+  }
+  return 0;
+}
+
+auto MaskAbove(Bits& bits, uint64_t top) -> void {
+  if (top % 64 != 63) {
+    bits.back() &= (uint64_t{1} << (top % 64 + 1)) - 1;
+  }
+}
+
+/**
+ * @brief out |= in << shift, within out's words.
+ */
+auto OrShifted(Bits& out, const Bits& in, uint64_t shift) -> void {
+  size_t word_shift = shift / 64;
+  size_t bit_shift = shift % 64;
+  size_t end = std::min(out.size(), in.size() + word_shift + 1);
+  for (size_t i = word_shift; i < end; ++i) {
+    size_t source = i - word_shift;
+    uint64_t word = source < in.size() ? in[source] << bit_shift : 0;
+    if (bit_shift != 0 && source > 0 && source - 1 < in.size()) {
+      word |= in[source - 1] >> (64 - bit_shift);
+    }
+    out[i] |= word;
+  }
+}
+
+/**
+ * @brief {a + b : a in first, b in second, a + b <= limit}.
+ */
+auto Sumset(const Bits& first, const Bits& second, uint64_t limit) -> Bits {
+  uint64_t first_top = Highest(first);
+  uint64_t second_top = Highest(second);
+  uint64_t top = std::min(limit, first_top + second_top);
+  Bits out(top / 64 + 1, 0);
+  size_t first_count = 0;
+  size_t second_count = 0;
+  for (uint64_t word : first) {
+    first_count += static_cast<size_t>(std::popcount(word));
+  }
+  for (uint64_t word : second) {
+    second_count += static_cast<size_t>(std::popcount(word));
+  }
+  const Bits& sparse = first_count <= second_count ? first : second;
+  const Bits& dense = first_count <= second_count ? second : first;
+  uint64_t sparse_count = std::min(first_count, second_count);
+  auto length = std::bit_ceil(first_top + second_top + 1);
+  auto levels = static_cast<uint64_t>(std::countr_zero(length));
+  if (sparse_count * out.size() <= kButterflyCost * length * levels) {
+    for (size_t w = 0; w < sparse.size(); ++w) {
+      for (uint64_t word = sparse[w]; word != 0; word &= word - 1) {
+        uint64_t shift = 64 * w + static_cast<uint64_t>(std::countr_zero(word));
+        if (shift > top) {
+          break;
+        }
+        OrShifted(out, dense, shift);
+      }
+    }
+    PARTITION_METRICS_COUNT(kDpWordsTouched, sparse_count * out.size());
+  } else {
+    // Counts of representations stay below the modulus (at most
+    // kMaxSumsetTarget + 1), so nonzero means reachable; the Montgomery
+    // and length factors only scale them.
+    std::vector<uint32_t> a(length, 0);
+    std::vector<uint32_t> b(length, 0);
+    for (uint64_t i = 0; i <= first_top; ++i) {
+      a[i] = TestBit(first, i) ? kMontgomeryOne : 0;
+    }
+    for (uint64_t i = 0; i <= second_top; ++i) {
+      b[i] = TestBit(second, i) ? kMontgomeryOne : 0;
+    }
+    Transform(a, false);
+    Transform(b, false);
+    for (size_t i = 0; i < length; ++i) {
+      a[i] = MontgomeryMul(a[i], b[i]);
+    }
+    b = std::vector<uint32_t>();
+    Transform(a, true);
+    for (uint64_t i = 0; i <= top; ++i) {
+      if (a[i] != 0) {
+        out[i / 64] |= uint64_t{1} << (i % 64);
+      }
+    }
+  }
+  MaskAbove(out, top);
+  return out;
+}
+
+/**
+ * @brief Sizes shuffled into random order, so that every contiguous range
+ * is a random group, with the subset sums of any range on demand.
+ */
+class SumsetTree {
+ public:
+  SumsetTree(const std::vector<uint64_t>& sizes, uint64_t limit,
+             uint64_t seed)
+      : sizes_(sizes) {
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      if (sizes[i] != 0 && sizes[i] <= limit) {
+        items_.push_back(i);
+      }
+    }
+    std::mt19937_64 rng(seed);
+    std::shuffle(items_.begin(), items_.end(), rng);
+    prefix_.assign(items_.size() + 1, 0);
+    for (size_t i = 0; i < items_.size(); ++i) {
+      prefix_[i + 1] = prefix_[i] + sizes_[items_[i]];
+    }
+  }
+
+  auto size() const -> size_t { return items_.size(); }
+
+  /**
+   * @brief Subset sums of items_[begin, end) up to limit.
+   */
+  auto Sums(size_t begin, size_t end, uint64_t limit) const -> Bits {
+    uint64_t top = std::min(limit, prefix_[end] - prefix_[begin]);
+    if (IsLeaf(begin, end, top)) {
+      return LeafSums(begin, end, top);
+    }
+    size_t middle = begin + (end - begin) / 2;
+    auto left = Sums(begin, middle, top);
+    auto right = Sums(middle, end, top);
+    return Sumset(left, right, top);
+  }
+
+  /**
+   * @brief Appends to out the indices of a subset of items_[begin, end)
+   * adding up to target.
+   */
+  auto Find(size_t begin, size_t end, uint64_t target,
+            std::vector<size_t>& out) const -> bool {
+    if (target == 0) {
+      return true;
+    }
+    if (target > prefix_[end] - prefix_[begin]) {
+      return false;
+    }
+    if (IsLeaf(begin, end, target)) {
+      std::vector<uint64_t> leaf;
+      for (size_t i = begin; i < end; ++i) {
+        leaf.push_back(sizes_[items_[i]]);
+      }
+      auto chosen = FindSubsetWithSum(leaf, target);
+      if (!chosen) {
+        return false;
+      }
+      for (size_t c : *chosen) {
+        out.push_back(items_[begin + c]);
+      }
+      return true;
+    }
+    size_t middle = begin + (end - begin) / 2;
+    uint64_t witness = 0;
+    bool found = false;
+    {
+      auto left = Sums(begin, middle, target);
+      auto right = Sums(middle, end, target);
+      for (size_t w = 0; w < left.size() && !found; ++w) {
+        for (uint64_t word = left[w]; word != 0; word &= word - 1) {
+          uint64_t a = 64 * w + static_cast<uint64_t>(std::countr_zero(word));
+          if (a <= target && TestBit(right, target - a)) {
+            witness = a;
+            found = true;
+            break;
+          }
+        }
+      }
+    }
+    return found && Find(begin, middle, witness, out) &&
+           Find(middle, end, target - witness, out);
+  }
+
+ private:
+  /**
+   * @brief true if the bitset DP over the group costs less than the
+   * transforms that would combine its halves.
+   */
+  auto IsLeaf(size_t begin, size_t end, uint64_t top) const -> bool {
+    uint64_t count = end - begin;
+    if (count <= kLeafElements) {
+      return true;
+    }
+    auto length = std::bit_ceil(2 * top + 1);
+    auto levels = static_cast<uint64_t>(std::countr_zero(length));
+    return count * (top / 64 + 1) <= kButterflyCost * length * levels;
+  }
+
+  auto LeafSums(size_t begin, size_t end, uint64_t top) const -> Bits {
+    Bits bits(top / 64 + 1, 0);
+    bits[0] = 1;
+    uint64_t words_touched = 0;
+    for (size_t e = begin; e < end; ++e) {
+      uint64_t size = sizes_[items_[e]];
+      if (size > top) {
+        continue;
+      }
+      size_t word_shift = size / 64;
+      size_t bit_shift = size % 64;
+      words_touched += bits.size() - word_shift;
+      for (size_t i = bits.size(); i-- > word_shift;) {
+        uint64_t shifted = bits[i - word_shift] << bit_shift;
+        if (bit_shift != 0 && i > word_shift) {
+          shifted |= bits[i - word_shift - 1] >> (64 - bit_shift);
+        }
+        bits[i] |= shifted;
+      }
+    }
+    MaskAbove(bits, top);
+    PARTITION_METRICS_COUNT(kDpWordsTouched, words_touched);
+    return bits;
+  }
+
+  const std::vector<uint64_t>& sizes_;
+  std::vector<size_t> items_;
+  std::vector<uint64_t> prefix_;
+};
+
+auto CheckLimit(uint64_t limit) -> void {
+  if (limit > kMaxSumsetTarget) {
+    throw std::length_error("Target sum " + std::to_string(limit) +
+                            " is too large for the sumset engine");
+  }
+}
+
+}  // namespace
+
+auto SubsetSumsConvolution(const std::vector<uint64_t>& sizes, uint64_t limit,
+                           uint64_t seed) -> std::vector<uint64_t> {
+  CheckLimit(limit);
+  SumsetTree tree(sizes, limit, seed);
+  auto sums = tree.Sums(0, tree.size(), limit);
+  sums.resize(limit / 64 + 1, 0);
+  return sums;
+}
+
+auto FindSubsetWithSumConvolution(const std::vector<uint64_t>& sizes,
+                                  uint64_t target, uint64_t seed)
+    -> std::optional<std::vector<size_t>> {
+  CheckLimit(target);
+  SumsetTree tree(sizes, target, seed);
+  std::vector<size_t> chosen;
+  if (!tree.Find(0, tree.size(), target, chosen)) {
+    return std::nullopt;
+  }
+  return chosen;
+}
+
+}  // namespace partition
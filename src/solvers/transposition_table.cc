@@ -0,0 +1,138 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for TranspositionTable.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/transposition_table.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace partition {
+
+namespace {
+
+constexpr int kGenerationShift = 32;
+constexpr int kDepthShift = 48;
+
+auto PackMeta(uint32_t index, uint16_t generation, uint32_t depth)
+    -> uint64_t {
+  uint64_t clamped = std::min<uint32_t>(depth, 0xFFFF);
+  return uint64_t{index} | uint64_t{generation} << kGenerationShift |
+         clamped << kDepthShift;
+}
+
+auto IndexOf(uint64_t meta) -> uint32_t { return static_cast<uint32_t>(meta); }
+
+auto GenerationOf(uint64_t meta) -> uint16_t {
+  return static_cast<uint16_t>(meta >> kGenerationShift);
+}
+
+auto DepthOf(uint64_t meta) -> uint32_t {
+  return static_cast<uint32_t>(meta >> kDepthShift);
+}
+
+/**
+ * @brief SplitMix64 finalizer; spreads nearby sums over the buckets.
+ */
+auto Mix(uint64_t value) -> uint64_t {
+  value ^= value >> 30;
+  value *= 0xBF58476D1CE4E5B9ULL;
+  value ^= value >> 27;
+  value *= 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
+auto BucketCountFor(size_t entries) -> size_t {
+  size_t buckets = (entries + TranspositionTable::kBucketEntries - 1) /
+                   TranspositionTable::kBucketEntries;
+  return std::bit_ceil(std::max<size_t>(1, buckets));
+}
+
+}  // namespace
+
+TranspositionTable::TranspositionTable(size_t entries)
+    : buckets_(std::make_unique<Bucket[]>(BucketCountFor(entries))),
+      bucket_count_(BucketCountFor(entries)) {}
+
+auto TranspositionTable::BytesFor(size_t entries) -> size_t {
+  return BucketCountFor(entries) * sizeof(Bucket);
+}
+
+auto TranspositionTable::NewSearch() -> void {
+  if (generation_ == std::numeric_limits<uint16_t>::max()) {
+    // Generation 0 marks never-written entries; wipe before reusing it.
+    for (size_t b = 0; b < bucket_count_; ++b) {
+      for (auto& entry : buckets_[b].entries) {
+        entry.meta.store(0, std::memory_order_relaxed);
+        entry.check.store(0, std::memory_order_relaxed);
+      }
+    }
+    generation_ = 0;
+  }
+  ++generation_;
+  hits_.store(0, std::memory_order_relaxed);
+  replacements_.store(0, std::memory_order_relaxed);
+}
+
+auto TranspositionTable::BucketOf(uint32_t index, uint64_t sum) const
+    -> Bucket& {
+  uint64_t hash = Mix(sum ^ Mix(index));
+  return buckets_[hash & (bucket_count_ - 1)];
+}
+
+auto TranspositionTable::Contains(uint32_t index, uint64_t sum) const
+    -> bool {
+  for (const auto& entry : BucketOf(index, sum).entries) {
+    uint64_t meta = entry.meta.load(std::memory_order_relaxed);
+    uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if (GenerationOf(meta) == generation_ && IndexOf(meta) == index &&
+        (check ^ meta) == sum) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+auto TranspositionTable::Insert(uint32_t index, uint64_t sum, uint32_t depth)
+    -> void {
+  auto& bucket = BucketOf(index, sum);
+  Entry* victim = nullptr;
+  uint32_t victim_depth = std::numeric_limits<uint32_t>::max();
+  bool free_entry = false;
+  for (auto& entry : bucket.entries) {
+    uint64_t meta = entry.meta.load(std::memory_order_relaxed);
+    if (GenerationOf(meta) != generation_) {
+      victim = &entry;
+      free_entry = true;
+      break;
+    }
+    if (IndexOf(meta) == index &&
+        (entry.check.load(std::memory_order_relaxed) ^ meta) == sum) {
+      return;
+    }
+    if (DepthOf(meta) < victim_depth) {
+      victim = &entry;
+      victim_depth = DepthOf(meta);
+    }
+  }
+  if (!free_entry) {
+    if (victim_depth > std::min<uint32_t>(depth, 0xFFFF)) {
+      return;  // Every resident entry guards a bigger subtree.
+    }
+    replacements_.fetch_add(1, std::memory_order_relaxed);
+  }
+  uint64_t meta = PackMeta(index, generation_, depth);
+  victim->meta.store(meta, std::memory_order_relaxed);
+  victim->check.store(sum ^ meta, std::memory_order_relaxed);
+}
+
+}  // namespace partition
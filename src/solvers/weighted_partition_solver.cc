@@ -0,0 +1,192 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for WeightedPartitionSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/weighted_partition_solver.h"
+#include "solvers/instance_features.h"
+#include "solvers/solver_cost_model.h"
+#include "solvers/sumset_subset_sum.h"
+#include "util/metrics.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace partition {
+
+template <typename Weight>
+WeightedPartitionSolver<Weight>::WeightedPartitionSolver(Algorithm algo)
+    : algorithm_(algo) {}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::Solve(
+    const WeightedPartition<Weight>& instance)
+    -> std::optional<std::vector<size_t>> {
+  PARTITION_METRICS_PHASE(kSolve);
+  if (instance.size() == 0 || instance.total() % 2 != 0) {
+    return std::nullopt;
+  }
+  auto algorithm = algorithm_;
+  if (algorithm == Algorithm::kAuto) {
+    algorithm = ChooseAlgorithm(instance);
+  }
+  switch (algorithm) {
+    case Algorithm::kDynamicProgramming:
+    case Algorithm::kMultisetDynamicProgramming:
+    case Algorithm::kSumsetConvolution:
+      return SolveDynamicProgramming(instance, algorithm);
+    case Algorithm::kBacktracking:
+    case Algorithm::kAuto:
+      return SolveBacktracking(instance);
+    case Algorithm::kGreedyHeuristic:
+      return SolveGreedy(instance);
+  }
+  return std::nullopt;
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::ChooseAlgorithm(
+    const WeightedPartition<Weight>& instance) const -> Algorithm {
+  // Too wide for any table: only backtracking can take it, and these
+  // sizes would not fit the features either.
+  if (instance.total() / 2 > PartitionSolver::kMaxDynamicProgrammingTarget) {
+    return Algorithm::kBacktracking;
+  }
+  std::vector<uint64_t> sizes(instance.weights().begin(),
+                              instance.weights().end());
+  return SolverCostModel().Choose(ExtractFeatures(sizes));
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::SolveDynamicProgramming(
+    const WeightedPartition<Weight>& instance, Algorithm algorithm)
+    -> std::optional<std::vector<size_t>> {
+  Weight target = instance.total() / 2;
+  if (target > PartitionSolver::kMaxDynamicProgrammingTarget) {
+    throw std::length_error("Target sum is too large for dynamic programming");
+  }
+  // Every size is at most the total, so it fits in 64 bits too.
+  std::vector<uint64_t> sizes(instance.weights().begin(),
+                              instance.weights().end());
+  if (algorithm == Algorithm::kMultisetDynamicProgramming) {
+    return FindMultisetWithSum(sizes, static_cast<uint64_t>(target));
+  }
+  if (algorithm == Algorithm::kSumsetConvolution) {
+    return FindSubsetWithSumConvolution(sizes, static_cast<uint64_t>(target));
+  }
+  return FindSubsetWithSum(sizes, static_cast<uint64_t>(target));
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::SortBySize(
+    const WeightedPartition<Weight>& instance) -> void {
+  const auto& weights = instance.weights();
+  order_.resize(weights.size());
+  std::iota(order_.begin(), order_.end(), 0);
+  std::stable_sort(order_.begin(), order_.end(), [&](size_t a, size_t b) {
+    return weights[a] > weights[b];
+  });
+  sorted_.resize(order_.size());
+  for (size_t i = 0; i < order_.size(); ++i) {
+    sorted_[i] = weights[order_[i]];
+  }
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::SolveBacktracking(
+    const WeightedPartition<Weight>& instance)
+    -> std::optional<std::vector<size_t>> {
+  SortBySize(instance);
+  suffix_sums_.assign(sorted_.size() + 1, 0);
+  for (size_t i = sorted_.size(); i-- > 0;) {
+    suffix_sums_[i] = suffix_sums_[i + 1] + sorted_[i];
+  }
+  target_ = instance.total() / 2;
+  nodes_explored_ = 0;
+  chosen_.clear();
+  // The largest element can always be placed on the first side by symmetry.
+  chosen_.push_back(0);
+  bool found = Backtrack(1, sorted_[0]);
+  PARTITION_METRICS_COUNT(kNodesExplored, nodes_explored_);
+  bool exhausted =
+      !found && node_budget_ != 0 && nodes_explored_ > node_budget_;
+  std::optional<std::vector<size_t>> subset;
+  if (found) {
+    subset.emplace();
+    subset->reserve(chosen_.size());
+    for (size_t position : chosen_) {
+      subset->push_back(order_[position]);
+    }
+  }
+  order_.clear();
+  sorted_.clear();
+  suffix_sums_.clear();
+  if (exhausted) {
+    throw std::length_error("Backtracking exceeded its budget of " +
+                            std::to_string(node_budget_) + " nodes");
+  }
+  return subset;
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::Backtrack(size_t index, Weight current)
+    -> bool {
+  ++nodes_explored_;
+  if (current == target_) {
+    return true;
+  }
+  if (node_budget_ != 0 && nodes_explored_ > node_budget_) {
+    return false;
+  }
+  if (current > target_ || index >= sorted_.size() ||
+      current + suffix_sums_[index] < target_) {
+    return false;
+  }
+  Weight size = sorted_[index];
+  if (size <= target_ - current) {
+    chosen_.push_back(index);
+    if (Backtrack(index + 1, current + size)) {
+      return true;
+    }
+    chosen_.pop_back();
+  }
+  return Backtrack(index + 1, current);
+}
+
+template <typename Weight>
+auto WeightedPartitionSolver<Weight>::SolveGreedy(
+    const WeightedPartition<Weight>& instance)
+    -> std::optional<std::vector<size_t>> {
+  SortBySize(instance);
+  Weight first_sum = 0;
+  Weight second_sum = 0;
+  std::vector<size_t> first;
+  for (size_t i = 0; i < sorted_.size(); ++i) {
+    if (first_sum <= second_sum) {
+      first_sum += sorted_[i];
+      first.push_back(order_[i]);
+    } else {
+      second_sum += sorted_[i];
+    }
+  }
+  order_.clear();
+  sorted_.clear();
+  if (first_sum != second_sum) {
+    return std::nullopt;
+  }
+  return first;
+}
+
+template class WeightedPartitionSolver<uint32_t>;
+template class WeightedPartitionSolver<uint64_t>;
+template class WeightedPartitionSolver<Uint128>;
+
+}  // namespace partition
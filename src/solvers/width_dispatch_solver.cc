@@ -0,0 +1,72 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for WidthDispatchSolver.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "solvers/width_dispatch_solver.h"
+#include "core/weighted_partition.h"
+#include "solvers/reduced_partition_solver.h"
+#include "solvers/weighted_partition_solver.h"
+
+#include <stdexcept>
+
+namespace partition {
+
+WidthDispatchSolver::WidthDispatchSolver(Algorithm algo,
+                                         uint64_t node_budget)
+    : algorithm_(algo), node_budget_(node_budget) {}
+
+auto WidthDispatchSolver::WidthFor(const ReducedPartitionInstance& instance)
+    -> WeightWidth {
+  // The total is 4T with T below 2^bit_width.
+  return WeightWidthFor(instance.bit_width() + 2);
+}
+
+auto WidthDispatchSolver::Solve(const ReducedPartitionInstance& instance)
+    -> std::optional<std::set<std::string>> {
+  last_width_ = WidthFor(instance);
+  // An uncovered element has no matching, and b1 = 2T - B may not exist.
+  if (instance.HasUncoveredSlot()) {
+    return std::nullopt;
+  }
+  if (last_width_ != WeightWidth::kMultiLimb) {
+    try {
+      return VisitWeightWidth(
+          last_width_,
+          [&](auto tag) -> std::optional<std::set<std::string>> {
+            using Weight = typename decltype(tag)::type;
+            auto weighted = ExpandWeights<Weight>(instance);
+            WeightedPartitionSolver<Weight> solver(algorithm_);
+            solver.SetNodeBudget(node_budget_);
+            auto indices = solver.Solve(weighted);
+            if (!indices) {
+              return std::nullopt;
+            }
+            std::set<std::string> subset;
+            for (size_t index : *indices) {
+              subset.insert(weighted.ElementId(index));
+            }
+            return subset;
+          });
+    } catch (const std::length_error&) {
+      // Out of budget, or a table too large: the exact cover decides.
+      last_width_ = WeightWidth::kMultiLimb;
+    } catch (const std::underflow_error&) {
+      return std::nullopt;
+    }
+  }
+  return ReducedPartitionSolver().Solve(instance);
+}
+
+auto WidthDispatchSolver::GetAlgorithmName() const -> std::string {
+  return PartitionSolver(algorithm_).GetAlgorithmName() +
+         " at the narrowest weight width";
+}
+
+}  // namespace partition
@@ -0,0 +1,199 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for BenchmarkHarness.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "util/benchmark_harness.h"
+#include "util/json_writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Nearest-rank percentile of sorted samples.
+ */
+auto Percentile(const std::vector<double>& sorted, double fraction)
+    -> double {
+  auto rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/**
+ * @brief Extracts a string or number field from one of our JSON lines.
+ */
+auto ExtractField(const std::string& line, const std::string& key)
+    -> std::string {
+  auto marker = "\"" + key + "\":";
+  auto found = line.find(marker);
+  if (found == std::string::npos) {
+    return "";
+  }
+  auto begin = found + marker.size();
+  if (begin < line.size() && line[begin] == '"') {
+    auto end = line.find('"', begin + 1);
+    return end == std::string::npos ? "" : line.substr(begin + 1, end - begin - 1);
+  }
+  auto end = line.find_first_of(",}", begin);
+  return line.substr(begin, end - begin);
+}
+
+}  // namespace
+
+auto BenchmarkResult::Throughput() const -> double {
+  if (work <= 0.0 || p50_ms <= 0.0) {
+    return 0.0;
+  }
+  return work * 1000.0 / p50_ms;
+}
+
+auto BenchmarkResult::ToJson() const -> std::string {
+  JsonObjectWriter json;
+  json.Add("name", name)
+      .Add("repetitions", repetitions)
+      .Add("min_ms", min_ms)
+      .Add("mean_ms", mean_ms)
+      .Add("p50_ms", p50_ms)
+      .Add("p90_ms", p90_ms)
+      .Add("p99_ms", p99_ms)
+      .Add("max_ms", max_ms);
+  if (!work_unit.empty()) {
+    json.Add("throughput", Throughput())
+        .Add("throughput_unit", work_unit + "/s");
+  }
+  return json.ToString();
+}
+
+BenchmarkHarness::BenchmarkHarness(BenchmarkOptions options)
+    : options_(std::move(options)) {
+  if (options_.repetitions == 0) {
+    throw std::invalid_argument("Benchmark repetitions must be positive");
+  }
+}
+
+auto BenchmarkHarness::Run(const std::string& name,
+                           const std::function<void()>& body, double work,
+                           const std::string& work_unit) -> void {
+  if (!options_.filter.empty() &&
+      name.find(options_.filter) == std::string::npos) {
+    return;
+  }
+  for (size_t i = 0; i < options_.warmup; ++i) {
+    body();
+  }
+  std::vector<double> samples;
+  samples.reserve(options_.repetitions);
+  for (size_t i = 0; i < options_.repetitions; ++i) {
+    auto start = Clock::now();
+    body();
+    samples.push_back(
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count());
+  }
+  std::sort(samples.begin(), samples.end());
+
+  BenchmarkResult result;
+  result.name = name;
+  result.repetitions = samples.size();
+  result.min_ms = samples.front();
+  result.max_ms = samples.back();
+  result.mean_ms =
+      std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+  result.p50_ms = Percentile(samples, 0.50);
+  result.p90_ms = Percentile(samples, 0.90);
+  result.p99_ms = Percentile(samples, 0.99);
+  result.work = work;
+  result.work_unit = work_unit;
+  results_.push_back(std::move(result));
+}
+
+auto BenchmarkHarness::ToJsonLines() const -> std::string {
+  std::string lines;
+  for (const auto& result : results_) {
+    lines += result.ToJson();
+    lines += '\n';
+  }
+  return lines;
+}
+
+auto BenchmarkHarness::GenerateReport() const -> std::string {
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(3);
+  report << std::left << std::setw(44) << "benchmark" << std::right
+         << std::setw(12) << "p50 ms" << std::setw(12) << "p90 ms"
+         << std::setw(12) << "p99 ms" << std::setw(12) << "min ms"
+         << "  throughput\n";
+  for (const auto& result : results_) {
+    report << std::left << std::setw(44) << result.name << std::right
+           << std::setw(12) << result.p50_ms << std::setw(12) << result.p90_ms
+           << std::setw(12) << result.p99_ms << std::setw(12) << result.min_ms;
+    if (!result.work_unit.empty()) {
+      report << "  " << std::setprecision(0) << result.Throughput() << " "
+             << result.work_unit << "/s" << std::setprecision(3);
+    }
+    report << "\n";
+  }
+  return report.str();
+}
+
+auto BenchmarkHarness::LoadBaseline(const std::string& filename)
+    -> std::map<std::string, double> {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  std::map<std::string, double> baseline;
+  std::string line;
+  while (std::getline(file, line)) {
+    auto name = ExtractField(line, "name");
+    auto median = ExtractField(line, "p50_ms");
+    if (!name.empty() && !median.empty()) {
+      baseline[name] = std::stod(median);
+    }
+  }
+  return baseline;
+}
+
+auto BenchmarkHarness::CompareWithBaseline(
+    const std::map<std::string, double>& baseline, double tolerance,
+    std::string& report) const -> size_t {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3);
+  size_t regressions = 0;
+  for (const auto& result : results_) {
+    auto found = baseline.find(result.name);
+    if (found == baseline.end()) {
+      out << result.name << ": no baseline\n";
+      continue;
+    }
+    double change = found->second > 0.0
+                        ? (result.p50_ms - found->second) / found->second
+                        : 0.0;
+    bool regressed = change > tolerance;
+    regressions += regressed ? 1 : 0;
+    out << result.name << ": " << found->second << " -> " << result.p50_ms
+        << " ms (" << std::showpos << change * 100.0 << std::noshowpos
+        << "%)" << (regressed ? " REGRESSION" : "") << "\n";
+  }
+  report = out.str();
+  return regressions;
+}
+
+}  // namespace partition
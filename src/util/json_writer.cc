@@ -0,0 +1,121 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for JsonObjectWriter.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "util/json_writer.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace partition {
+
+auto JsonEscape(std::string_view text) -> std::string {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (char c : text) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\r':
+        escaped += "\\r";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                        static_cast<unsigned>(c));
+          escaped += buffer;
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+auto JsonObjectWriter::AppendKey(std::string_view key) -> void {
+  if (!body_.empty()) {
+    body_ += ',';
+  }
+  body_ += '"';
+  body_ += JsonEscape(key);
+  body_ += "\":";
+}
+
+auto JsonObjectWriter::Add(std::string_view key, std::string_view value)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  body_ += '"';
+  body_ += JsonEscape(value);
+  body_ += '"';
+  return *this;
+}
+
+auto JsonObjectWriter::Add(std::string_view key, const char* value)
+    -> JsonObjectWriter& {
+  return Add(key, std::string_view(value));
+}
+
+auto JsonObjectWriter::Add(std::string_view key, bool value)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  body_ += value ? "true" : "false";
+  return *this;
+}
+
+auto JsonObjectWriter::Add(std::string_view key, int64_t value)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  body_ += std::to_string(value);
+  return *this;
+}
+
+auto JsonObjectWriter::Add(std::string_view key, uint64_t value)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  body_ += std::to_string(value);
+  return *this;
+}
+
+auto JsonObjectWriter::Add(std::string_view key, double value)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  if (!std::isfinite(value)) {
+    body_ += "null";
+    return *this;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+  body_ += buffer;
+  return *this;
+}
+
+auto JsonObjectWriter::AddRaw(std::string_view key, std::string_view json)
+    -> JsonObjectWriter& {
+  AppendKey(key);
+  body_ += json;
+  return *this;
+}
+
+auto JsonObjectWriter::ToString() const -> std::string {
+  return "{" + body_ + "}";
+}
+
+}  // namespace partition
@@ -0,0 +1,101 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the memory accounting utilities.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "util/memory_accounting.h"
+
+#include <sys/resource.h>
+
+#include <cctype>
+#include <stdexcept>
+
+namespace partition {
+
+auto CountingMemoryResource::do_allocate(size_t bytes, size_t alignment)
+    -> void* {
+  void* pointer = upstream_->allocate(bytes, alignment);
+  allocations_.fetch_add(1, std::memory_order_relaxed);
+  size_t now = in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  size_t peak = peak_.load(std::memory_order_relaxed);
+  while (now > peak &&
+         !peak_.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+  }
+  return pointer;
+}
+
+auto CountingMemoryResource::do_deallocate(void* pointer, size_t bytes,
+                                           size_t alignment) -> void {
+  upstream_->deallocate(pointer, bytes, alignment);
+  in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+auto MemoryBudget::Acquire(size_t bytes) -> bool {
+  if (!Fits(bytes)) {
+    return false;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (limit_ != 0) {
+    released_.wait(lock, [&] { return reserved_ + bytes <= limit_; });
+  }
+  reserved_ += bytes;
+  return true;
+}
+
+auto MemoryBudget::Release(size_t bytes) -> void {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reserved_ -= bytes;
+  }
+  released_.notify_all();
+}
+
+auto MemoryBudget::bytes_reserved() const -> size_t {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return reserved_;
+}
+
+auto PeakResidentBytes() -> size_t {
+  rusage usage{};
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // Linux reports ru_maxrss in kilobytes.
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+}
+
+auto ParseByteSize(const std::string& text) -> size_t {
+  size_t consumed = 0;
+  unsigned long long value = std::stoull(text, &consumed);
+  std::string suffix = text.substr(consumed);
+  if (suffix.size() > 1 && (suffix.back() == 'B' || suffix.back() == 'b')) {
+    suffix.pop_back();
+  }
+  if (suffix.empty()) {
+    return value;
+  }
+  if (suffix.size() == 1) {
+    switch (std::toupper(static_cast<unsigned char>(suffix[0]))) {
+      case 'K':
+        return value << 10;
+      case 'M':
+        return value << 20;
+      case 'G':
+        return value << 30;
+    }
+  }
+  throw std::invalid_argument("Invalid byte size: " + text);
+}
+
+auto StringHeapBytes(size_t length) -> size_t {
+  // libstdc++ strings hold up to 15 characters inline.
+  return length > 15 ? length + 1 : 0;
+}
+
+}  // namespace partition
@@ -0,0 +1,129 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for the per-phase instrumentation layer.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "util/metrics.h"
+#include "util/json_writer.h"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace partition {
+
+namespace {
+
+constexpr size_t kPhaseCount = static_cast<size_t>(MetricsPhase::kCount);
+constexpr size_t kCounterCount = static_cast<size_t>(MetricsCounter::kCount);
+
+auto Seconds(uint64_t nanoseconds) -> double {
+  return static_cast<double>(nanoseconds) / 1e9;
+}
+
+}  // namespace
+
+auto MetricsRegistry::Global() -> MetricsRegistry& {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+auto MetricsRegistry::Reset() -> void {
+  for (auto& slot : phases_) {
+    slot.nanoseconds.store(0, std::memory_order_relaxed);
+    slot.calls.store(0, std::memory_order_relaxed);
+  }
+  for (auto& value : counters_) {
+    value.store(0, std::memory_order_relaxed);
+  }
+}
+
+auto MetricsRegistry::PhaseName(MetricsPhase phase) -> const char* {
+  static constexpr const char* kNames[kPhaseCount] = {
+      "parse", "index_map", "weights", "write", "solve", "map_back", "verify"};
+  return kNames[static_cast<size_t>(phase)];
+}
+
+auto MetricsRegistry::CounterName(MetricsCounter counter) -> const char* {
+  static constexpr const char* kNames[kCounterCount] = {
+      "bytes_parsed", "triples_reduced", "nodes_explored", "dp_words_touched",
+      "transposition_hits", "filter_rejections"};
+  return kNames[static_cast<size_t>(counter)];
+}
+
+auto MetricsRegistry::ToJson() const -> std::string {
+  JsonObjectWriter phases;
+  for (size_t i = 0; i < kPhaseCount; ++i) {
+    auto phase = static_cast<MetricsPhase>(i);
+    JsonObjectWriter entry;
+    entry.Add("seconds", Seconds(phase_nanoseconds(phase)))
+        .Add("nanoseconds", phase_nanoseconds(phase))
+        .Add("calls", phase_calls(phase));
+    phases.AddRaw(PhaseName(phase), entry.ToString());
+  }
+  JsonObjectWriter counters;
+  for (size_t i = 0; i < kCounterCount; ++i) {
+    auto which = static_cast<MetricsCounter>(i);
+    counters.Add(CounterName(which), counter(which));
+  }
+  JsonObjectWriter root;
+  root.Add("enabled", Enabled())
+      .AddRaw("phases", phases.ToString())
+      .AddRaw("counters", counters.ToString());
+  return root.ToString();
+}
+
+auto MetricsRegistry::ToPrometheus() const -> std::string {
+  std::string text;
+  char line[160];
+  text += "# HELP partition_phase_seconds_total Time spent in each phase.\n";
+  text += "# TYPE partition_phase_seconds_total counter\n";
+  for (size_t i = 0; i < kPhaseCount; ++i) {
+    auto phase = static_cast<MetricsPhase>(i);
+    std::snprintf(line, sizeof(line),
+                  "partition_phase_seconds_total{phase=\"%s\"} %.9f\n",
+                  PhaseName(phase), Seconds(phase_nanoseconds(phase)));
+    text += line;
+  }
+  text += "# HELP partition_phase_calls_total Times each phase ran.\n";
+  text += "# TYPE partition_phase_calls_total counter\n";
+  for (size_t i = 0; i < kPhaseCount; ++i) {
+    auto phase = static_cast<MetricsPhase>(i);
+    std::snprintf(line, sizeof(line),
+                  "partition_phase_calls_total{phase=\"%s\"} %llu\n",
+                  PhaseName(phase),
+                  static_cast<unsigned long long>(phase_calls(phase)));
+    text += line;
+  }
+  for (size_t i = 0; i < kCounterCount; ++i) {
+    auto which = static_cast<MetricsCounter>(i);
+    std::snprintf(line, sizeof(line),
+                  "# TYPE partition_%s_total counter\n"
+                  "partition_%s_total %llu\n",
+                  CounterName(which), CounterName(which),
+                  static_cast<unsigned long long>(counter(which)));
+    text += line;
+  }
+  return text;
+}
+
+auto MetricsRegistry::WriteToFile(const std::string& filename) const -> void {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Could not open file: " + filename);
+  }
+  bool prometheus = filename.size() >= 5 &&
+                    filename.compare(filename.size() - 5, 5, ".prom") == 0;
+  file << (prometheus ? ToPrometheus() : ToJson() + "\n");
+  if (!file) {
+    throw std::runtime_error("Error writing to file: " + filename);
+  }
+}
+
+}  // namespace partition
@@ -0,0 +1,125 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Complejidad computacional
+ *
+ * @brief Implementation file for WorkStealingPool.
+ * @authors Fabián González Lence, Diego Hernández Chico, Enmanuel Vegas Acosta, Luis David Romero Romero, Eric Ríos Hamilton
+ * @date 19-10-2026
+ */
+
+#include "util/work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace partition {
+
+namespace {
+
+/// Pool and worker index of the calling thread, if it is a pool worker.
+thread_local const WorkStealingPool* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+}  // namespace
+
+WorkStealingPool::WorkStealingPool(size_t threads) {
+  if (threads == 0) {
+    threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+  queues_.reserve(threads);
+  for (size_t i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  workers_.reserve(threads);
+  for (size_t i = 0; i < threads; ++i) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  WaitIdle();
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    stopping_ = true;
+  }
+  work_available_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+auto WorkStealingPool::Submit(Task task) -> void {
+  size_t target = current_pool == this
+                      ? current_worker
+                      : next_queue_.fetch_add(1) % queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(queues_[target]->mutex);
+    queues_[target]->tasks.push_back(std::move(task));
+  }
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    ++queued_;
+    ++unfinished_;
+  }
+  work_available_.notify_one();
+}
+
+auto WorkStealingPool::WaitIdle() -> void {
+  std::unique_lock<std::mutex> lock(state_mutex_);
+  idle_.wait(lock, [this] { return unfinished_ == 0; });
+}
+
+auto WorkStealingPool::TryPop(size_t worker, Task& task) -> bool {
+  {
+    auto& own = *queues_[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  for (size_t offset = 1; offset < queues_.size(); ++offset) {
+    auto& victim = *queues_[(worker + offset) % queues_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+auto WorkStealingPool::WorkerLoop(size_t worker) -> void {
+  current_pool = this;
+  current_worker = worker;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      work_available_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+      if (queued_ == 0) {
+        return;
+      }
+      // Claim one queued task; it is in some deque and TryPop will find it
+      // because every claim is matched by exactly one pop.
+      --queued_;
+    }
+    Task task;
+    while (!TryPop(worker, task)) {
+      std::this_thread::yield();
+    }
+    task(worker);
+    bool idle = false;
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      idle = --unfinished_ == 0;
+    }
+    if (idle) {
+      idle_.notify_all();
+    }
+  }
+}
+
+}  // namespace partition